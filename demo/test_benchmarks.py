@@ -0,0 +1,134 @@
+"""Performance regression benchmarks over a curated set of demos.
+
+Compiles a curated subset of the demo forms with ``--benchmark`` and
+``--profile_file``, builds and runs the generated timing driver, and
+compares compiler-stage times and per-kernel ns/cell against JSON
+baselines stored next to this file.
+
+The suite only runs when FFCX_BENCHMARK is set in the environment,
+since the numbers are machine specific and timing in shared CI is too
+noisy for a hard gate. On first run (or with FFCX_BENCHMARK_UPDATE set)
+the measured numbers are recorded as the baseline; later runs fail when
+a kernel gets more than FFCX_BENCHMARK_THRESHOLD times slower than its
+baseline (default 1.5) or a compiler stage more than
+FFCX_BENCHMARK_STAGE_THRESHOLD times slower (default 2.0, stage times
+are noisier).
+"""
+
+import json
+import os
+import re
+import subprocess
+
+import pytest
+
+demo_dir = os.path.dirname(os.path.realpath(__file__))
+baseline_file = os.path.join(demo_dir, "benchmark_baselines.json")
+
+# Curated subset covering hyperelastic cell kernels, mixed elements,
+# quadrilateral cells and facet integrals
+demos = ["HyperElasticity", "StabilisedStokes", "PoissonQuad", "FacetIntegrals"]
+
+kernel_threshold = float(os.environ.get("FFCX_BENCHMARK_THRESHOLD", "1.5"))
+stage_threshold = float(os.environ.get("FFCX_BENCHMARK_STAGE_THRESHOLD", "2.0"))
+
+pytestmark = pytest.mark.skipif(
+    not os.environ.get("FFCX_BENCHMARK"),
+    reason="performance benchmarks only run when FFCX_BENCHMARK is set",
+)
+
+
+def _load_baselines() -> dict:
+    try:
+        with open(baseline_file) as f:
+            return json.load(f)
+    except FileNotFoundError:
+        return {}
+
+
+def _store_baselines(baselines: dict) -> None:
+    with open(baseline_file, "w") as f:
+        json.dump(baselines, f, indent=2, sort_keys=True)
+        f.write("\n")
+
+
+def _run_benchmark(file: str) -> dict:
+    """Compile a demo with the timing driver and run it.
+
+    Returns the compiler-stage times from the compilation profile and
+    the ns/cell reported by the driver for each generated kernel.
+    """
+    profile = os.path.join(demo_dir, f"{file}_profile.json")
+    subprocess.run(
+        ["ffcx", "--benchmark", "--profile_file", profile, f"{file}.py"],
+        cwd=demo_dir,
+        check=True,
+    )
+
+    cc = os.environ.get("CC", "cc")
+    exe = os.path.join(demo_dir, f"{file}_benchmark")
+    subprocess.run(
+        [
+            cc,
+            "-O2",
+            "-std=c17",
+            # Honor any SIMD pragmas in the generated kernels
+            "-fopenmp-simd",
+            "-I../ffcx/codegeneration",
+            f"{file}_benchmark.c",
+            f"{file}.c",
+            "-lm",
+            "-o",
+            exe,
+        ],
+        cwd=demo_dir,
+        check=True,
+    )
+    out = subprocess.run([exe], cwd=demo_dir, check=True, capture_output=True, text=True).stdout
+
+    # The driver prints the kernel name at column 0 followed by an
+    # indented "ns/cell:" line
+    kernels = {}
+    current = None
+    for line in out.splitlines():
+        match = re.match(r"\s+ns/cell:\s+([0-9.eE+-]+)", line)
+        if match and current is not None:
+            kernels[current] = float(match.group(1))
+        elif line and not line.startswith(" "):
+            current = line.strip()
+    assert kernels, f"No kernel timings in driver output:\n{out}"
+
+    with open(profile) as f:
+        stages = json.load(f)["stages"]
+
+    return {"stages": stages, "kernels": kernels}
+
+
+@pytest.mark.parametrize("file", demos)
+def test_benchmark(file):
+    """Benchmark a demo against its recorded baseline."""
+    result = _run_benchmark(file)
+
+    baselines = _load_baselines()
+    if os.environ.get("FFCX_BENCHMARK_UPDATE") or file not in baselines:
+        baselines[file] = result
+        _store_baselines(baselines)
+        pytest.skip(f"Recorded baseline for {file} in {baseline_file}")
+
+    base = baselines[file]
+    regressions = []
+    for kernel, ns_per_cell in result["kernels"].items():
+        ref = base["kernels"].get(kernel)
+        if ref is not None and ns_per_cell > kernel_threshold * ref:
+            regressions.append(
+                f"{kernel}: {ns_per_cell:.1f} ns/cell, baseline {ref:.1f}"
+                f" (threshold {kernel_threshold}x)"
+            )
+    for stage, seconds in result["stages"].items():
+        ref = base["stages"].get(stage)
+        if ref is not None and seconds > stage_threshold * ref:
+            regressions.append(
+                f"stage {stage}: {seconds:.3f} s, baseline {ref:.3f}"
+                f" (threshold {stage_threshold}x)"
+            )
+    assert not regressions, "Performance regressions:\n" + "\n".join(regressions)
@@ -0,0 +1,97 @@
+# Copyright (C) 2026 The FEniCS Project
+#
+# This file is part of FFCx. (https://www.fenicsproject.org)
+#
+# SPDX-License-Identifier:    LGPL-3.0-or-later
+"""Generate a standalone C benchmark driver for the generated kernels."""
+
+from math import prod
+
+import numpy as np
+
+from ffcx import __version__ as FFCX_VERSION
+from ffcx.codegeneration.C import benchmark_template
+from ffcx.codegeneration.utils import dtype_to_c_type, dtype_to_scalar_dtype
+from ffcx.ir.representation import DataIR, IntegralIR
+
+
+def _coefficient_size(integral_ir: IntegralIR) -> int:
+    """Upper bound on the size of the coefficient array w."""
+    expression = integral_ir.expression
+    size = 1
+    for coefficient, offset in expression.coefficient_offsets.items():
+        dim = coefficient.ufl_function_space().ufl_element().dim
+        # Factor 2 covers both restrictions of interior facet integrals
+        size = max(size, offset + 2 * dim)
+    return size
+
+
+def _constant_size(integral_ir: IntegralIR) -> int:
+    """Size of the constants array c."""
+    size = 1
+    for constant, offset in integral_ir.expression.original_constant_offsets.items():
+        size = max(size, offset + prod(constant.ufl_shape, start=1))
+    return size
+
+
+def _coordinate_size(integral_ir: IntegralIR) -> int:
+    """Upper bound on the size of the coordinate dofs array.
+
+    The number of coordinate element dofs is bounded by the largest dof
+    dimension among the tabulated element tables.
+    """
+    max_dofs = 8
+    for tables in integral_ir.expression.unique_tables.values():
+        values = tables.values() if isinstance(tables, dict) else [tables]
+        for table in values:
+            if hasattr(table, "shape") and len(table.shape) == 4:
+                max_dofs = max(max_dofs, table.shape[3])
+    # Coordinate dofs are always 3d; factor 2 covers both restrictions
+    return 3 * max_dofs * 2
+
+
+def generate_benchmark(ir: DataIR, options, prefix: str) -> str:
+    """Generate a self-contained benchmark driver for all integral kernels.
+
+    The driver calls each generated tabulate_tensor kernel in a timing
+    loop with synthetic inputs and reports time per cell and approximate
+    memory traffic. It is plain C with no dependencies beyond libc and
+    the generated code itself.
+    """
+    scalar_type = dtype_to_c_type(np.dtype(options["scalar_type"]))
+    geom_type = dtype_to_c_type(dtype_to_scalar_dtype(options["scalar_type"]))
+
+    code = benchmark_template.driver_pre.format(
+        prefix=prefix,
+        ffcx_version=FFCX_VERSION,
+        scalar_type=scalar_type,
+        geom_type=geom_type,
+    )
+
+    names = []
+    for integral_ir in ir.integrals:
+        # One kernel is emitted per (integral, domain) pair
+        for domain in set(i[0] for i in integral_ir.expression.integrand.keys()):
+            name = f"{integral_ir.expression.name}_{domain.name}"
+            names.append(name)
+            # The generated header only declares the ufcx_integral
+            # structs, so declare the kernel itself before calling it
+            code += benchmark_template.kernel_prototype.format(
+                name=name,
+                scalar_type=scalar_type,
+                geom_type=geom_type,
+            )
+            code += benchmark_template.kernel_benchmark.format(
+                name=name,
+                scalar_type=scalar_type,
+                geom_type=geom_type,
+                A_size=max(1, prod(integral_ir.expression.tensor_shape, start=1)),
+                w_size=_coefficient_size(integral_ir),
+                c_size=_constant_size(integral_ir),
+                coord_size=_coordinate_size(integral_ir),
+            )
+
+    calls = "".join(f"  bench_{name}();\n" for name in names)
+    code += benchmark_template.driver_post.format(calls=calls)
+
+    return code
@@ -0,0 +1,129 @@
+# Code generation format strings for UFC (Unified Form-assembly Code)
+# This code is released into the public domain.
+#
+# The FEniCS Project (http://www.fenicsproject.org/) 2018
+"""Code generation strings for a kernel benchmark driver."""
+
+driver_pre = """
+// Benchmark driver for the kernels in {prefix}.c, automatically
+// generated by FFCx version {ffcx_version}.
+//
+// Build together with the generated code, e.g.
+//   cc -O2 -I<path to ufcx.h> {prefix}_benchmark.c {prefix}.c -lm
+//
+// Each kernel is run on synthetic inputs in a timing loop and the
+// time per cell and approximate memory traffic are reported.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "{prefix}.h"
+
+static double bench_now(void)
+{{
+  struct timespec t;
+  timespec_get(&t, TIME_UTC);
+  return (double)t.tv_sec + 1e-9 * (double)t.tv_nsec;
+}}
+
+// Reproducible values in [1, 2) avoid degenerate geometry and
+// denormal inputs
+static double bench_value(size_t i)
+{{
+  return 1.0 + 0.5 * ((double)((1103515245 * i + 12345) % 1000) / 1000.0);
+}}
+
+static void bench_fill_scalar({scalar_type}* x, size_t n)
+{{
+  for (size_t i = 0; i < n; ++i)
+    x[i] = ({scalar_type})bench_value(i);
+}}
+
+static void bench_fill_real({geom_type}* x, size_t n)
+{{
+  for (size_t i = 0; i < n; ++i)
+    x[i] = ({geom_type})bench_value(i);
+}}
+
+static void bench_report(const char* name, double seconds, long ncalls,
+                         size_t bytes_per_cell)
+{{
+  double per_cell = seconds / (double)ncalls;
+  printf("%s\\n", name);
+  printf("  ns/cell:  %10.1f\\n", 1e9 * per_cell);
+  printf("  cells/s:  %10.3e\\n", 1.0 / per_cell);
+  printf("  MB/s:     %10.1f  (%zu bytes moved per cell)\\n",
+         (double)bytes_per_cell / per_cell / 1e6, bytes_per_cell);
+}}
+"""
+
+kernel_prototype = """
+void tabulate_tensor_{name}({scalar_type}* restrict A,
+                            const {scalar_type}* restrict w,
+                            const {scalar_type}* restrict c,
+                            const {geom_type}* restrict coordinate_dofs,
+                            const int* restrict entity_local_index,
+                            const uint8_t* restrict quadrature_permutation,
+                            void* custom_data);
+"""
+
+kernel_benchmark = """
+static void bench_{name}(void)
+{{
+  enum
+  {{
+    A_size = {A_size},
+    w_size = {w_size},
+    c_size = {c_size},
+    coord_size = {coord_size}
+  }};
+
+  {scalar_type}* A = calloc(A_size, sizeof({scalar_type}));
+  {scalar_type}* w = calloc(w_size, sizeof({scalar_type}));
+  {scalar_type}* c = calloc(c_size, sizeof({scalar_type}));
+  {geom_type}* coordinate_dofs = calloc(coord_size, sizeof({geom_type}));
+  int entity_local_index[2] = {{0, 0}};
+  uint8_t quadrature_permutation[2] = {{0, 0}};
+
+  bench_fill_scalar(w, w_size);
+  bench_fill_scalar(c, c_size);
+  bench_fill_real(coordinate_dofs, coord_size);
+
+  // Warm up, then run for at least half a second
+  tabulate_tensor_{name}(A, w, c, coordinate_dofs, entity_local_index,
+                         quadrature_permutation, NULL);
+  long ncalls = 0;
+  double t0 = bench_now(), t1 = t0;
+  while (t1 - t0 < 0.5)
+  {{
+    for (int i = 0; i < 100; ++i)
+    {{
+      memset(A, 0, A_size * sizeof({scalar_type}));
+      tabulate_tensor_{name}(A, w, c, coordinate_dofs, entity_local_index,
+                             quadrature_permutation, NULL);
+    }}
+    ncalls += 100;
+    t1 = bench_now();
+  }}
+
+  size_t bytes_per_cell = (A_size + w_size + c_size) * sizeof({scalar_type})
+                          + coord_size * sizeof({geom_type});
+  bench_report("{name}", t1 - t0, ncalls, bytes_per_cell);
+
+  free(A);
+  free(w);
+  free(c);
+  free(coordinate_dofs);
+}}
+"""
+
+driver_post = """
+int main(void)
+{{
+{calls}
+  return 0;
+}}
+"""
@@ -220,13 +220,14 @@ class CFormatter:
 
         symbol = self.c_format(arr.symbol)
         dims = "".join([f"[{i}]" for i in arr.sizes])
+        align = f"_Alignas({arr.align}) " if getattr(arr, "align", 0) else ""
         if arr.values is None:
             assert arr.const is False
-            return f"{typename} {symbol}{dims};\n"
+            return f"{align}{typename} {symbol}{dims};\n"
 
         vals = self._build_initializer_lists(arr.values)
         cstr = "static const " if arr.const else ""
-        return f"{cstr}{typename} {symbol}{dims} = {vals};\n"
+        return f"{align}{cstr}{typename} {symbol}{dims} = {vals};\n"
 
     def format_array_access(self, arr) -> str:
         """Format an array access."""
@@ -290,7 +291,8 @@ class CFormatter:
         begin = self.c_format(r.begin)
         end = self.c_format(r.end)
         index = self.c_format(r.index)
-        output = f"for (int {index} = {begin}; {index} < {end}; ++{index})\n"
+        output = "".join(f"#pragma {p}\n" for p in r.pragmas)
+        output += f"for (int {index} = {begin}; {index} < {end}; ++{index})\n"
         output += "{\n"
         body = self.c_format(r.body)
         for line in body.split("\n"):
@@ -75,6 +75,13 @@ def generator(ir: ExpressionIR, options):
     d["num_constants"] = len(ir.constant_names)
     d["num_points"] = points.shape[0]
     d["entity_dimension"] = points.shape[1]
+
+    # Number of per-cell entries in entity_local_index and
+    # quadrature_permutation, used to advance the pointers in the
+    # batched kernel; cell expressions ignore both
+    num_entities = 0 if ir.expression.entity_type == "cell" else 1
+    d["num_entity_indices"] = num_entities
+    d["num_quadrature_permutations"] = num_entities
     d["scalar_type"] = dtype_to_c_type(options["scalar_type"])
     d["geom_type"] = dtype_to_c_type(dtype_to_scalar_dtype(options["scalar_type"]))
     d["np_scalar_type"] = np.dtype(options["scalar_type"]).name
@@ -29,6 +29,28 @@ void tabulate_tensor_{factory_name}({scalar_type}* restrict A,
 {tabulate_expression}
 }}
 
+void tabulate_tensor_batch_{factory_name}(int num_cells,
+                                          {scalar_type}* restrict A,
+                                          const {scalar_type}* restrict w,
+                                          const {scalar_type}* restrict c,
+                                          const {geom_type}* restrict coordinate_dofs,
+                                          const int* restrict entity_local_index,
+                                          const uint8_t* restrict quadrature_permutation,
+                                          void* custom_data,
+                                          int A_stride, int w_stride,
+                                          int coordinate_dofs_stride)
+{{
+  for (int cell = 0; cell < num_cells; ++cell)
+  {{
+    tabulate_tensor_{factory_name}(
+        A + (size_t)cell * A_stride, w + (size_t)cell * w_stride, c,
+        coordinate_dofs + (size_t)cell * coordinate_dofs_stride,
+        entity_local_index ? entity_local_index + (size_t)cell * {num_entity_indices} : NULL,
+        quadrature_permutation ? quadrature_permutation + (size_t)cell * {num_quadrature_permutations} : NULL,
+        custom_data);
+  }}
+}}
+
 {points_init}
 {value_shape_init}
 {original_coefficient_positions_init}
@@ -39,6 +61,7 @@ void tabulate_tensor_{factory_name}({scalar_type}* restrict A,
 ufcx_expression {factory_name} =
 {{
   .tabulate_tensor_{np_scalar_type} = tabulate_tensor_{factory_name},
+  .tabulate_tensor_batch_{np_scalar_type} = tabulate_tensor_batch_{factory_name},
   .num_coefficients = {num_coefficients},
   .num_constants = {num_constants},
   .original_coefficient_positions = {original_coefficient_positions},
@@ -17,6 +17,8 @@ import numpy as np
 from ffcx import __version__ as FFCX_VERSION
 from ffcx.codegeneration import __version__ as UFC_VERSION
 from ffcx.codegeneration.C import file_template
+from ffcx.codegeneration.C.c_implementation import CFormatter
+from ffcx.codegeneration.utils import c_string_escape, dtype_to_c_type, dtype_to_scalar_dtype
 
 logger = logging.getLogger("ffcx")
 
@@ -46,3 +48,104 @@ def generator(options):
     )
 
     return code_pre, code_post
+
+
+def table_pool_generator(table_pool, options):
+    """Generate file-scope definitions for pooled element tables."""
+    if not table_pool.declarations:
+        return "", ""
+
+    sidecar = str(options.get("table_sidecar", "") or "")
+    if sidecar:
+        return "", _sidecar_tables(table_pool.declarations, sidecar, options)
+
+    CF = CFormatter(options["scalar_type"])
+    body = "".join(CF.c_format(decl) for decl in table_pool.declarations)
+    comment = "// Element tables shared by the integrals in this file\n"
+    return "", comment + body + "\n"
+
+
+def _sidecar_tables(declarations, path, options):
+    """Write pooled tables to a binary sidecar and generate the loader.
+
+    The table values are written to path in native byte order, each
+    table starting on a 64-byte boundary, and the generated file keeps
+    only table shapes and offsets: pointers-to-array that the static
+    ffcx_load_tables() points into a read-only mapping of the sidecar on
+    first use. The mapping is done under pthread_once, so concurrent
+    kernel calls are safe, and ffcx_load_tables() returns nonzero if
+    the sidecar cannot be mapped (after reporting the reason on stderr
+    once); the kernels then return without touching the tables. This
+    avoids parsing the values as C initializer lists and carrying them
+    as initialized data in the shared object; the mapping is shared
+    between processes using the same module. POSIX only.
+    """
+    typename = dtype_to_c_type(dtype_to_scalar_dtype(options["scalar_type"]))
+
+    offsets = []
+    blob = bytearray()
+    for decl in declarations:
+        blob.extend(b"\0" * ((-len(blob)) % 64))
+        offsets.append(len(blob))
+        blob.extend(np.ascontiguousarray(decl.values).tobytes())
+    with open(path, "wb") as f:
+        f.write(blob)
+
+    dims = ["".join(f"[{n}]" for n in decl.values.shape[1:]) for decl in declarations]
+    lines = [
+        "// Element tables shared by the integrals in this file, loaded",
+        "// from a binary sidecar written at compile time",
+        "#include <errno.h>",
+        "#include <fcntl.h>",
+        "#include <pthread.h>",
+        "#include <stdio.h>",
+        "#include <string.h>",
+        "#include <sys/mman.h>",
+        "#include <unistd.h>",
+        "",
+    ]
+    lines += [
+        f"static const {typename} (*{decl.symbol.name}){dim} = NULL;"
+        for decl, dim in zip(declarations, dims)
+    ]
+    lines += [
+        "",
+        "static pthread_once_t ffcx_tables_once = PTHREAD_ONCE_INIT;",
+        "static int ffcx_tables_status = -1;",
+        f'static const char ffcx_sidecar_path[] = "{c_string_escape(path)}";',
+        "",
+        "static void ffcx_map_tables(void)",
+        "{",
+        "  int fd = open(ffcx_sidecar_path, O_RDONLY);",
+        "  if (fd == -1)",
+        "  {",
+        '    fprintf(stderr, "FFCx: cannot open table sidecar %s: %s\\n", ffcx_sidecar_path,',
+        "            strerror(errno));",
+        "    return;",
+        "  }",
+        f"  const char* base = (const char*)mmap(NULL, {len(blob)}, PROT_READ, MAP_PRIVATE, fd, 0);",
+        "  close(fd);",
+        "  if (base == (const char*)MAP_FAILED)",
+        "  {",
+        '    fprintf(stderr, "FFCx: cannot map table sidecar %s: %s\\n", ffcx_sidecar_path,',
+        "            strerror(errno));",
+        "    return;",
+        "  }",
+    ]
+    lines += [
+        f"  {decl.symbol.name} = (const {typename} (*){dim})(base + {offset});"
+        for decl, dim, offset in zip(declarations, dims, offsets)
+    ]
+    lines += [
+        "  ffcx_tables_status = 0;",
+        "}",
+        "",
+        "// Returns 0 when the tables are mapped; safe to call concurrently",
+        "static int ffcx_load_tables(void)",
+        "{",
+        "  pthread_once(&ffcx_tables_once, ffcx_map_tables);",
+        "  return ffcx_tables_status;",
+        "}",
+        "",
+    ]
+    return "\n".join(lines) + "\n"
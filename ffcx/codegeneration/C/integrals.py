@@ -11,17 +11,28 @@ import sys
 import basix
 import numpy as np
 
+import ffcx.codegeneration.lnodes as L
 from ffcx.codegeneration.backend import FFCXBackend
 from ffcx.codegeneration.C import integrals_template as ufcx_integrals
 from ffcx.codegeneration.C.c_implementation import CFormatter
 from ffcx.codegeneration.integral_generator import IntegralGenerator
-from ffcx.codegeneration.utils import dtype_to_c_type, dtype_to_scalar_dtype
+from ffcx.codegeneration.device.integrals import generator as device_generator
+from ffcx.codegeneration.utils import c_string_escape, dtype_to_c_type, dtype_to_scalar_dtype
+from ffcx.ir.integral import TensorPart
 from ffcx.ir.representation import IntegralIR
 
 logger = logging.getLogger("ffcx")
 
 
-def generator(ir: IntegralIR, domain: basix.CellType, options):
+def _c_string_literal(text: str) -> str:
+    """Format text as a concatenation of C string literal lines."""
+    lines = []
+    for line in text.split("\n"):
+        lines.append(f'"{c_string_escape(line)}\\n"')
+    return "\n".join(lines)
+
+
+def generator(ir: IntegralIR, domain: basix.CellType, options, table_pool=None):
     """Generate C code for an integral."""
     logger.info("Generating code for integral:")
     logger.info(f"--- type: {ir.expression.integral_type}")
@@ -36,7 +47,7 @@ def generator(ir: IntegralIR, domain: basix.CellType, options):
     backend = FFCXBackend(ir, options)
 
     # Configure kernel generator
-    ig = IntegralGenerator(ir, backend)
+    ig = IntegralGenerator(ir, backend, table_pool)
 
     # Generate code ast for the tabulate_tensor body
     parts = ig.generate(domain)
@@ -45,6 +56,13 @@ def generator(ir: IntegralIR, domain: basix.CellType, options):
     CF = CFormatter(options["scalar_type"])
     body = CF.c_format(parts)
 
+    # With a table sidecar, the pooled element tables are mapped into
+    # memory on first use of any kernel in this file; if the sidecar
+    # cannot be mapped the kernel leaves the tensor untouched
+    sidecar = table_pool is not None and options.get("table_sidecar")
+    if sidecar:
+        body = "if (ffcx_load_tables() != 0) return;\n" + body
+
     # Generate generic FFCx code snippets and add specific parts
     code = {}
 
@@ -59,20 +77,121 @@ def generator(ir: IntegralIR, domain: basix.CellType, options):
         code["enabled_coefficients_init"] = ""
         code["enabled_coefficients"] = "NULL"
 
+    # Structural non-zero pattern of the element tensor: the union of
+    # the dofblocks over all quadrature rules on this domain. Only
+    # emitted when part of the tensor is structurally zero, e.g. for
+    # mixed elements with uncoupled subspaces.
+    code["nonzero_pattern_init"] = ""
+    code["nonzero_pattern"] = "NULL"
+    tensor_shape = ir.expression.tensor_shape
+    if len(tensor_shape) > 0 and ir.part == TensorPart.full:
+        pattern = np.zeros(tensor_shape, dtype=bool)
+        for (cell, _), integrand in ir.expression.integrand.items():
+            if cell == domain:
+                for blockmap in integrand["block_contributions"]:
+                    pattern[np.ix_(*blockmap)] = True
+        if not pattern.all():
+            values = ", ".join("1" if v else "0" for v in pattern.flat)
+            code["nonzero_pattern_init"] = (
+                f"bool nonzero_pattern_{factory_name}[{pattern.size}] = {{{values}}};"
+            )
+            code["nonzero_pattern"] = f"nonzero_pattern_{factory_name}"
+
     code["tabulate_tensor"] = body
 
+    # Optionally specialize interior-facet kernels for each quadrature
+    # permutation pair. Each variant indexes the permutation-major
+    # table dimension with compile-time constants, removing the runtime
+    # indirection from the inner table contractions.
+    code["specialized_kernels"] = ""
+    code["tabulate_tensor_permuted"] = "NULL"
+    num_facet_permutations = 0
+    if ir.expression.integral_type == "interior_facet" and options.get(
+        "specialize_facet_permutations"
+    ):
+        tables = ir.expression.unique_tables[domain]
+        num_perms = max((table.shape[0] for table in tables.values()), default=1)
+        if num_perms > 1:
+            kernels = []
+            names = []
+            for p0 in range(num_perms):
+                for p1 in range(num_perms):
+                    variant_backend = FFCXBackend(ir, options)
+                    variant_backend.symbols.quadrature_permutation = (
+                        L.LiteralInt(p0),
+                        L.LiteralInt(p1),
+                    )
+                    variant_ig = IntegralGenerator(ir, variant_backend, table_pool)
+                    variant_body = CF.c_format(variant_ig.generate(domain))
+                    if sidecar:
+                        variant_body = "if (ffcx_load_tables() != 0) return;\n" + variant_body
+                    names.append(f"tabulate_tensor_{factory_name}_p{p0}_{p1}")
+                    kernels.append(
+                        ufcx_integrals.permuted_kernel.format(
+                            factory_name=factory_name,
+                            p0=p0,
+                            p1=p1,
+                            scalar_type=dtype_to_c_type(options["scalar_type"]),
+                            geom_type=dtype_to_c_type(dtype_to_scalar_dtype(options["scalar_type"])),
+                            tabulate_tensor=variant_body,
+                        )
+                    )
+            num_facet_permutations = num_perms
+            pointers = ", ".join(f"(void*){name}" for name in names)
+            kernels.append(
+                f"void* tabulate_tensor_permuted_{factory_name}[{num_perms * num_perms}] = "
+                f"{{{pointers}}};\n"
+            )
+            code["specialized_kernels"] = "".join(kernels)
+            code["tabulate_tensor_permuted"] = f"tabulate_tensor_permuted_{factory_name}"
+
+    # Optionally embed an equivalent CUDA/HIP device kernel as source
+    # for runtime compilation
+    code["device_src_init"] = ""
+    code["tabulate_tensor_device_src"] = "NULL"
+    code["tabulate_tensor_device_name"] = "NULL"
+    if options.get("device_backend", "none") != "none":
+        device = device_generator(ir, domain, options)
+        if device is not None:
+            device_src, device_kernel_name = device
+            code["device_src_init"] = (
+                f"static const char tabulate_tensor_device_src_{factory_name}[] =\n"
+                f"{_c_string_literal(device_src)};"
+            )
+            code["tabulate_tensor_device_src"] = f"tabulate_tensor_device_src_{factory_name}"
+            code["tabulate_tensor_device_name"] = f'"{device_kernel_name}"'
+
     code["tabulate_tensor_float32"] = ".tabulate_tensor_float32 = NULL,"
     code["tabulate_tensor_float64"] = ".tabulate_tensor_float64 = NULL,"
+    code["tabulate_tensor_batch_float32"] = ".tabulate_tensor_batch_float32 = NULL,"
+    code["tabulate_tensor_batch_float64"] = ".tabulate_tensor_batch_float64 = NULL,"
     if sys.platform.startswith("win32"):
         code["tabulate_tensor_complex64"] = ""
         code["tabulate_tensor_complex128"] = ""
+        code["tabulate_tensor_batch_complex64"] = ""
+        code["tabulate_tensor_batch_complex128"] = ""
     else:
         code["tabulate_tensor_complex64"] = ".tabulate_tensor_complex64 = NULL,"
         code["tabulate_tensor_complex128"] = ".tabulate_tensor_complex128 = NULL,"
+        code["tabulate_tensor_batch_complex64"] = ".tabulate_tensor_batch_complex64 = NULL,"
+        code["tabulate_tensor_batch_complex128"] = ".tabulate_tensor_batch_complex128 = NULL,"
     np_scalar_type = np.dtype(options["scalar_type"]).name
     code[f"tabulate_tensor_{np_scalar_type}"] = (
         f".tabulate_tensor_{np_scalar_type} = tabulate_tensor_{factory_name},"
     )
+    code[f"tabulate_tensor_batch_{np_scalar_type}"] = (
+        f".tabulate_tensor_batch_{np_scalar_type} = tabulate_tensor_batch_{factory_name},"
+    )
+
+    # Number of per-cell entries in entity_local_index and
+    # quadrature_permutation, used to advance the pointers in the
+    # batched kernel
+    if ir.expression.integral_type == "interior_facet":
+        num_entity_indices, num_quadrature_permutations = 2, 2
+    elif ir.expression.integral_type == "cell":
+        num_entity_indices, num_quadrature_permutations = 0, 0
+    else:
+        num_entity_indices, num_quadrature_permutations = 1, 1
 
     assert ir.expression.coordinate_element_hash is not None
     implementation = ufcx_integrals.factory.format(
@@ -81,6 +200,17 @@ def generator(ir: IntegralIR, domain: basix.CellType, options):
         enabled_coefficients_init=code["enabled_coefficients_init"],
         tabulate_tensor=code["tabulate_tensor"],
         needs_facet_permutations="true" if ir.expression.needs_facet_permutations else "false",
+        nonzero_pattern_init=code["nonzero_pattern_init"],
+        nonzero_pattern=code["nonzero_pattern"],
+        symmetric="true"
+        if ir.part == TensorPart.symmetric and len(tensor_shape) == 2
+        else "false",
+        specialized_kernels=code["specialized_kernels"],
+        num_facet_permutations=num_facet_permutations,
+        tabulate_tensor_permuted=code["tabulate_tensor_permuted"],
+        device_src_init=code["device_src_init"],
+        tabulate_tensor_device_src=code["tabulate_tensor_device_src"],
+        tabulate_tensor_device_name=code["tabulate_tensor_device_name"],
         scalar_type=dtype_to_c_type(options["scalar_type"]),
         geom_type=dtype_to_c_type(dtype_to_scalar_dtype(options["scalar_type"])),
         coordinate_element_hash=f"UINT64_C({ir.expression.coordinate_element_hash})",
@@ -88,6 +218,12 @@ def generator(ir: IntegralIR, domain: basix.CellType, options):
         tabulate_tensor_float64=code["tabulate_tensor_float64"],
         tabulate_tensor_complex64=code["tabulate_tensor_complex64"],
         tabulate_tensor_complex128=code["tabulate_tensor_complex128"],
+        tabulate_tensor_batch_float32=code["tabulate_tensor_batch_float32"],
+        tabulate_tensor_batch_float64=code["tabulate_tensor_batch_float64"],
+        tabulate_tensor_batch_complex64=code["tabulate_tensor_batch_complex64"],
+        tabulate_tensor_batch_complex128=code["tabulate_tensor_batch_complex128"],
+        num_entity_indices=num_entity_indices,
+        num_quadrature_permutations=num_quadrature_permutations,
         domain=int(domain),
     )
 
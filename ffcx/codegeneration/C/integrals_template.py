@@ -22,7 +22,32 @@ void tabulate_tensor_{factory_name}({scalar_type}* restrict A,
 {tabulate_tensor}
 }}
 
+void tabulate_tensor_batch_{factory_name}(int num_cells,
+                                          {scalar_type}* restrict A,
+                                          const {scalar_type}* restrict w,
+                                          const {scalar_type}* restrict c,
+                                          const {geom_type}* restrict coordinate_dofs,
+                                          const int* restrict entity_local_index,
+                                          const uint8_t* restrict quadrature_permutation,
+                                          void* custom_data,
+                                          int A_stride, int w_stride,
+                                          int coordinate_dofs_stride)
+{{
+  for (int cell = 0; cell < num_cells; ++cell)
+  {{
+    tabulate_tensor_{factory_name}(
+        A + (size_t)cell * A_stride, w + (size_t)cell * w_stride, c,
+        coordinate_dofs + (size_t)cell * coordinate_dofs_stride,
+        entity_local_index ? entity_local_index + (size_t)cell * {num_entity_indices} : NULL,
+        quadrature_permutation ? quadrature_permutation + (size_t)cell * {num_quadrature_permutations} : NULL,
+        custom_data);
+  }}
+}}
+
+{specialized_kernels}
 {enabled_coefficients_init}
+{nonzero_pattern_init}
+{device_src_init}
 
 ufcx_integral {factory_name} =
 {{
@@ -31,10 +56,35 @@ ufcx_integral {factory_name} =
   {tabulate_tensor_float64}
   {tabulate_tensor_complex64}
   {tabulate_tensor_complex128}
+  {tabulate_tensor_batch_float32}
+  {tabulate_tensor_batch_float64}
+  {tabulate_tensor_batch_complex64}
+  {tabulate_tensor_batch_complex128}
   .needs_facet_permutations = {needs_facet_permutations},
+  .nonzero_pattern = {nonzero_pattern},
+  .symmetric = {symmetric},
+  .num_facet_permutations = {num_facet_permutations},
+  .tabulate_tensor_permuted = {tabulate_tensor_permuted},
+  .tabulate_tensor_device_src = {tabulate_tensor_device_src},
+  .tabulate_tensor_device_name = {tabulate_tensor_device_name},
   .coordinate_element_hash = {coordinate_element_hash},
   .domain = {domain},
 }};
 
 // End of code for integral {factory_name}
 """
+
+permuted_kernel = """
+// Specialization of tabulate_tensor_{factory_name} for
+// quadrature_permutation = {{{p0}, {p1}}}
+void tabulate_tensor_{factory_name}_p{p0}_{p1}({scalar_type}* restrict A,
+                                    const {scalar_type}* restrict w,
+                                    const {scalar_type}* restrict c,
+                                    const {geom_type}* restrict coordinate_dofs,
+                                    const int* restrict entity_local_index,
+                                    const uint8_t* restrict quadrature_permutation,
+                                    void* custom_data)
+{{
+{tabulate_tensor}
+}}
+"""
@@ -12,20 +12,63 @@ UFC function from an intermediate representation (IR).
 
 from __future__ import annotations
 
+import concurrent.futures
 import logging
 import typing
 
 import numpy.typing as npt
 
+from ffcx import profiling
 from ffcx.codegeneration.C.expressions import generator as expression_generator
 from ffcx.codegeneration.C.file import generator as file_generator
+from ffcx.codegeneration.C.file import table_pool_generator
 from ffcx.codegeneration.C.form import generator as form_generator
 from ffcx.codegeneration.C.integrals import generator as integral_generator
+from ffcx.codegeneration.integral_generator import TablePool
 from ffcx.ir.representation import DataIR
 
 logger = logging.getLogger("ffcx")
 
 
+def stream_code(
+    ir: DataIR, options: dict[str, int | float | npt.DTypeLike], h_out: typing.IO, c_out: typing.IO
+) -> None:
+    """Generate code and write it to text streams one block at a time.
+
+    Produces the same file layout as generate_code followed by
+    format_code, but each block is written and released as soon as it
+    is generated, so peak memory is bounded by the largest single
+    kernel instead of by the whole file. Element tables are declared
+    in-kernel rather than pooled at file scope, since the pool contents
+    are only complete after the last integral.
+    """
+    logger.info(79 * "*")
+    logger.info("Compiler stage 3: Generating and streaming code")
+    logger.info(79 * "*")
+
+    code_file_pre, code_file_post = file_generator(options)
+    h_out.write(code_file_pre[0])
+    c_out.write(code_file_pre[1])
+
+    for integral_ir in ir.integrals:
+        with profiling.time_integral(integral_ir.expression.name, "generate_time"):
+            for domain in set(i[0] for i in integral_ir.expression.integrand.keys()):
+                declaration, implementation = integral_generator(integral_ir, domain, options)
+                h_out.write(declaration)
+                c_out.write(implementation)
+    for form_ir in ir.forms:
+        declaration, implementation = form_generator(form_ir, options)
+        h_out.write(declaration)
+        c_out.write(implementation)
+    for expression_ir in ir.expressions:
+        declaration, implementation = expression_generator(expression_ir, options)
+        h_out.write(declaration)
+        c_out.write(implementation)
+
+    h_out.write(code_file_post[0])
+    c_out.write(code_file_post[1])
+
+
 class CodeBlocks(typing.NamedTuple):
     """Storage of code blocks of the form (declaration, implementation).
 
@@ -39,24 +82,110 @@ class CodeBlocks(typing.NamedTuple):
     file_post: list[tuple[str, str]]
 
 
-def generate_code(ir: DataIR, options: dict[str, int | float | npt.DTypeLike]) -> CodeBlocks:
-    """Generate code blocks from intermediate representation."""
-    logger.info(79 * "*")
-    logger.info("Compiler stage 3: Generating code")
-    logger.info(79 * "*")
+def _generate_integral_code(task) -> tuple[str, str]:
+    """Generate code for one (integral IR, domain) pair in a worker process."""
+    integral_ir, domain, options = task
+    return integral_generator(integral_ir, domain, options)
+
+
+def _generate_form_code(task) -> tuple[str, str]:
+    """Generate code for one form IR in a worker process."""
+    form_ir, options = task
+    return form_generator(form_ir, options)
 
-    code_integrals = [
-        integral_generator(integral_ir, domain, options)
+
+def _generate_expression_code(task) -> tuple[str, str]:
+    """Generate code for one expression IR in a worker process."""
+    expression_ir, options = task
+    return expression_generator(expression_ir, options)
+
+
+def _generate_code_parallel(
+    ir: DataIR, options: dict[str, int | float | npt.DTypeLike], workers: int
+) -> CodeBlocks:
+    """Generate code blocks with a pool of worker processes.
+
+    The integral IRs are independent by construction and the LNodes
+    trees pickle cleanly, so each (integral, domain) pair is generated
+    in its own worker; executor.map preserves submission order, keeping
+    the output deterministic. Element tables are declared in-kernel
+    rather than pooled at file scope, since the pool is shared mutable
+    state that is only complete after the last integral.
+    """
+    integral_tasks = [
+        (integral_ir, domain, options)
         for integral_ir in ir.integrals
         for domain in set(i[0] for i in integral_ir.expression.integrand.keys())
     ]
+    form_tasks = [(form_ir, options) for form_ir in ir.forms]
+    expression_tasks = [(expression_ir, options) for expression_ir in ir.expressions]
+
+    with concurrent.futures.ProcessPoolExecutor(max_workers=workers) as pool:
+        code_integrals = list(pool.map(_generate_integral_code, integral_tasks))
+        code_forms = list(pool.map(_generate_form_code, form_tasks))
+        code_expressions = list(pool.map(_generate_expression_code, expression_tasks))
+
+    code_file_pre, code_file_post = file_generator(options)
+    return CodeBlocks(
+        file_pre=[code_file_pre],
+        integrals=code_integrals,
+        forms=code_forms,
+        expressions=code_expressions,
+        file_post=[code_file_post],
+    )
+
+
+def generate_code(
+    ir: DataIR, options: dict[str, int | float | npt.DTypeLike], workers: int = 1
+) -> CodeBlocks:
+    """Generate code blocks from intermediate representation.
+
+    Args:
+        ir: Intermediate representation.
+        options: Options.
+        workers: Number of worker processes generating integrals, forms
+            and expressions concurrently. With 1 generation runs in this
+            process and element tables are pooled across the file.
+    """
+    logger.info(79 * "*")
+    logger.info("Compiler stage 3: Generating code")
+    logger.info(79 * "*")
+
+    if workers > 1:
+        return _generate_code_parallel(ir, options, workers)
+
+    # Element tables are pooled across all integrals in the file, so
+    # identical tables from different kernels are only emitted once
+    table_pool = TablePool(options)
+    code_integrals = []
+    for integral_ir in ir.integrals:
+        name = integral_ir.expression.name
+        if profiling.is_enabled():
+            # Static kernel metrics: scalar graph size and table footprint
+            operations = sum(
+                len(integrand["factorization"].nodes)
+                for integrand in integral_ir.expression.integrand.values()
+            )
+            profiling.record_integral_metric(name, "scalar_graph_nodes", operations)
+            table_bytes = sum(
+                table.nbytes
+                for tables in integral_ir.expression.unique_tables.values()
+                for table in tables.values()
+            )
+            profiling.record_integral_metric(name, "table_bytes", table_bytes)
+        with profiling.time_integral(name, "generate_time"):
+            for domain in set(i[0] for i in integral_ir.expression.integrand.keys()):
+                code_integrals.append(
+                    integral_generator(integral_ir, domain, options, table_pool)
+                )
     code_forms = [form_generator(form_ir, options) for form_ir in ir.forms]
     code_expressions = [
         expression_generator(expression_ir, options) for expression_ir in ir.expressions
     ]
     code_file_pre, code_file_post = file_generator(options)
+    code_table_pool = table_pool_generator(table_pool, options)
     return CodeBlocks(
-        file_pre=[code_file_pre],
+        file_pre=[code_file_pre, code_table_pool],
         integrals=code_integrals,
         forms=code_forms,
         expressions=code_expressions,
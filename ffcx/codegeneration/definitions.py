@@ -149,9 +149,25 @@ class FFCXBackendDefinitions:
 
         # Get access to element table
         FE, tables = self.access.table_access(tabledata, self.entity_type, mt.restriction, iq, ic)
-        dof_access: L.ArrayAccess = self.symbols.coefficient_dof_access(
-            mt.terminal, (ic.global_index) * bs + begin
+
+        # With packed coefficient scratch enabled, block-strided dofs are
+        # read through a contiguous per-kernel scratch array filled by a
+        # prologue that the integral generator emits, instead of striding
+        # through w inside the contraction loop
+        packed = (
+            self.options["packed_coefficients"]
+            and bs > 1
+            and not tabledata.has_tensor_factorisation
+            and self.integral_type != "expression"
         )
+        if packed:
+            dof_access, _ = self.symbols.coefficient_dof_access_blocked(
+                mt.terminal, ic.global_index, bs, begin, num_dofs
+            )
+        else:
+            dof_access = self.symbols.coefficient_dof_access(
+                mt.terminal, (ic.global_index) * bs + begin
+            )
 
         declaration: list[L.Declaration] = [L.VariableDecl(access, 0.0)]
         body = [L.AssignAdd(access, dof_access * FE)]
@@ -193,13 +209,6 @@ class FFCXBackendDefinitions:
         assert ttype != "zeros"
         assert ttype != "ones"
 
-        # Get access to element table
-        ic_symbol = self.symbols.coefficient_dof_sum_index
-        iq_symbol = self.symbols.quadrature_loop_index
-        ic = create_dof_index(tabledata, ic_symbol)
-        iq = create_quadrature_index(quadrature_rule, iq_symbol)
-        FE, tables = self.access.table_access(tabledata, self.entity_type, mt.restriction, iq, ic)
-
         dof_access = L.Symbol("coordinate_dofs", dtype=L.DataType.REAL)
 
         # coordinate dofs is always 3d
@@ -208,6 +217,30 @@ class FFCXBackendDefinitions:
         if mt.restriction == "-":
             offset = num_scalar_dofs * dim
 
+        # For affine geometry the coordinate element table is constant
+        # per cell: unroll the linear combination with its literal
+        # weights, so the Jacobian folds to plain differences of vertex
+        # coordinates instead of a loop over the coordinate element dofs
+        tbl = tabledata.values
+        if tabledata.is_piecewise and tbl.shape[0] == 1 and tbl.shape[1] == 1:
+            terms = [
+                L.float_product([L.LiteralFloat(float(w)), dof_access[k * dim + begin + offset]])
+                for k, w in enumerate(tbl[0][0][0])
+                if w != 0.0
+            ]
+            value = L.Sum(terms) if terms else L.LiteralFloat(0.0)
+            declaration = [L.VariableDecl(access, value)]
+
+            name = type(mt.terminal).__name__
+            return L.Section(name, [], declaration, [dof_access], [access], [L.Annotation.fuse])
+
+        # Get access to element table
+        ic_symbol = self.symbols.coefficient_dof_sum_index
+        iq_symbol = self.symbols.quadrature_loop_index
+        ic = create_dof_index(tabledata, ic_symbol)
+        iq = create_quadrature_index(quadrature_rule, iq_symbol)
+        FE, tables = self.access.table_access(tabledata, self.entity_type, mt.restriction, iq, ic)
+
         code = []
         declaration = [L.VariableDecl(access, 0.0)]
         body = [L.AssignAdd(access, dof_access[ic.global_index * dim + begin + offset] * FE)]
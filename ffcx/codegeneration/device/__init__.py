@@ -0,0 +1 @@
+"""Generation of CUDA/HIP device code."""
@@ -0,0 +1,49 @@
+# Copyright (C) 2026 The FEniCS Project
+#
+# This file is part of FFCx. (https://www.fenicsproject.org)
+#
+# SPDX-License-Identifier:    LGPL-3.0-or-later
+"""Code generation strings for a CUDA/HIP device integral kernel.
+
+The generated source is self-contained C++ suitable for runtime
+compilation with NVRTC or hipRTC, or for offline compilation with
+nvcc/hipcc. No host headers are included.
+"""
+
+factory = """
+// Device code for integral {factory_name}
+// Compile with NVRTC/hipRTC or nvcc/hipcc
+
+typedef unsigned char uint8_t;
+
+__device__ void tabulate_tensor_device_{factory_name}(
+    {scalar_type}* A, const {scalar_type}* w, const {scalar_type}* c,
+    const {geom_type}* coordinate_dofs, const int* entity_local_index,
+    const uint8_t* quadrature_permutation, void* custom_data)
+{{
+{tabulate_tensor}
+}}
+
+// One cell per thread; launch with any 1D grid covering num_cells
+extern "C" __global__ void {kernel_name}(
+    int num_cells, {scalar_type}* A, const {scalar_type}* w,
+    const {scalar_type}* c, const {geom_type}* coordinate_dofs,
+    const int* entity_local_index, const uint8_t* quadrature_permutation,
+    int A_stride, int w_stride, int coordinate_dofs_stride)
+{{
+  int cell = blockIdx.x * blockDim.x + threadIdx.x;
+  if (cell >= num_cells)
+    return;
+  tabulate_tensor_device_{factory_name}(
+      A + (unsigned long long)cell * A_stride,
+      w + (unsigned long long)cell * w_stride, c,
+      coordinate_dofs + (unsigned long long)cell * coordinate_dofs_stride,
+      entity_local_index
+          ? entity_local_index + (unsigned long long)cell * {num_entity_indices}
+          : nullptr,
+      quadrature_permutation
+          ? quadrature_permutation + (unsigned long long)cell * {num_quadrature_permutations}
+          : nullptr,
+      nullptr);
+}}
+"""
@@ -0,0 +1,72 @@
+# Copyright (C) 2026 The FEniCS Project
+#
+# This file is part of FFCx. (https://www.fenicsproject.org)
+#
+# SPDX-License-Identifier:    LGPL-3.0-or-later
+"""Generate CUDA/HIP device code for an integral."""
+
+import logging
+
+import basix
+import numpy as np
+
+from ffcx.codegeneration.backend import FFCXBackend
+from ffcx.codegeneration.C.c_implementation import CFormatter
+from ffcx.codegeneration.device import device_template
+from ffcx.codegeneration.integral_generator import IntegralGenerator
+from ffcx.codegeneration.utils import dtype_to_c_type, dtype_to_scalar_dtype
+from ffcx.ir.representation import IntegralIR
+
+logger = logging.getLogger("ffcx")
+
+
+def generator(ir: IntegralIR, domain: basix.CellType, options) -> tuple[str, str] | None:
+    """Generate device code for an integral.
+
+    The kernel body is lowered from the same LNodes IR as the C kernel
+    and wrapped in a batched __global__ entry point that maps one cell
+    to one thread. Element tables are emitted as static device arrays
+    inside the kernel.
+
+    Returns:
+        Pair of (source, kernel name), or None if the scalar type is
+        not supported on device.
+    """
+    if np.issubdtype(np.dtype(options["scalar_type"]), np.complexfloating):
+        logger.debug("Device kernels are not generated for complex scalar types.")
+        return None
+
+    logger.info("Generating device code for integral:")
+    logger.info(f"--- type: {ir.expression.integral_type}")
+    logger.info(f"--- name: {ir.expression.name}")
+
+    factory_name = f"{ir.expression.name}_{domain.name}"
+    kernel_name = f"tabulate_tensor_batch_device_{factory_name}"
+
+    # Lower the integral body; tables are declared in-kernel, so the
+    # source is self-contained (no file-scope table pool)
+    backend = FFCXBackend(ir, options)
+    ig = IntegralGenerator(ir, backend)
+    parts = ig.generate(domain)
+
+    CF = CFormatter(options["scalar_type"])
+    body = CF.c_format(parts)
+
+    if ir.expression.integral_type == "interior_facet":
+        num_entity_indices, num_quadrature_permutations = 2, 2
+    elif ir.expression.integral_type == "cell":
+        num_entity_indices, num_quadrature_permutations = 0, 0
+    else:
+        num_entity_indices, num_quadrature_permutations = 1, 1
+
+    source = device_template.factory.format(
+        factory_name=factory_name,
+        kernel_name=kernel_name,
+        tabulate_tensor=body,
+        scalar_type=dtype_to_c_type(options["scalar_type"]),
+        geom_type=dtype_to_c_type(dtype_to_scalar_dtype(options["scalar_type"])),
+        num_entity_indices=num_entity_indices,
+        num_quadrature_permutations=num_quadrature_permutations,
+    )
+
+    return source, kernel_name
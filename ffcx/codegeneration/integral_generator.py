@@ -13,12 +13,20 @@ from numbers import Integral
 from typing import Any
 
 import basix
+import numpy as np
 import ufl
 
 import ffcx.codegeneration.lnodes as L
 from ffcx.codegeneration import geometry
 from ffcx.codegeneration.definitions import create_dof_index, create_quadrature_index
-from ffcx.codegeneration.optimizer import optimize
+from ffcx.codegeneration.optimizer import (
+    fuse_loops,
+    fuse_sections,
+    optimize,
+    reuse_arrays,
+    unroll_loops,
+)
+from ffcx.codegeneration.utils import dtype_to_scalar_dtype
 from ffcx.ir.elementtables import piecewise_ttypes
 from ffcx.ir.integral import BlockDataT, TensorPart
 from ffcx.ir.representationutils import QuadratureRule
@@ -42,14 +50,74 @@ def extract_dtype(v, vops: list[Any]):
     return L.DataType.BOOL if is_cond else L.merge_dtypes(dtypes)
 
 
+def pad_table(table, options):
+    """Pad the trailing (dof) dimension of an element table.
+
+    With a positive table_alignment option the trailing dimension is
+    zero-padded to a multiple of the alignment, so every row of the
+    table starts on an aligned boundary. Loop bounds are unaffected:
+    they come from the unpadded table data.
+    """
+    alignment = int(options.get("table_alignment", 0))
+    if alignment <= 0:
+        return table
+    itemsize = np.dtype(dtype_to_scalar_dtype(options["scalar_type"])).itemsize
+    lanes = max(alignment // itemsize, 1)
+    num_dofs = table.shape[-1]
+    padded_dofs = -(-num_dofs // lanes) * lanes
+    if padded_dofs == num_dofs:
+        return table
+    padded = np.zeros(table.shape[:-1] + (padded_dofs,), dtype=table.dtype)
+    padded[..., :num_dofs] = table
+    return padded
+
+
+class TablePool:
+    """Pool of element tables shared by all integrals in one output file.
+
+    Tables are keyed by their contents, so byte-identical tables
+    produced by different integrals (e.g. when several forms are
+    compiled over the same function spaces) are emitted once at file
+    scope instead of once per kernel.
+    """
+
+    def __init__(self, options=None):
+        """Initialise."""
+        self.options = options if options is not None else {}
+        self.symbols: dict[tuple, L.Symbol] = {}
+        self.declarations: list[L.ArrayDecl] = []
+
+    def symbol(self, table) -> L.Symbol:
+        """Return the file-scope symbol holding the values of table."""
+        table = pad_table(table, self.options)
+        key = (table.dtype.str, table.shape, table.tobytes())
+        symbol = self.symbols.get(key)
+        if symbol is None:
+            symbol = L.Symbol(f"FE_pool{len(self.symbols)}", dtype=L.DataType.REAL)
+            self.symbols[key] = symbol
+            self.declarations.append(
+                L.ArrayDecl(
+                    symbol,
+                    values=table,
+                    const=True,
+                    align=int(self.options.get("table_alignment", 0)),
+                )
+            )
+        return symbol
+
+
 class IntegralGenerator:
     """Integral generator."""
 
-    def __init__(self, ir, backend):
+    def __init__(self, ir, backend, table_pool: TablePool | None = None):
         """Initialise."""
         # Store ir
         self.ir = ir
 
+        # Optional pool of element tables shared across integrals; when
+        # set, tables are declared at file scope instead of in-kernel
+        self.table_pool = table_pool
+
         # Backend specific plugin with attributes
         # - symbols: for translating ufl operators to target language
         # - definitions: for defining backend specific variables
@@ -130,6 +198,13 @@ class IntegralGenerator:
             self.temp_symbols[key] = s
         return s, defined
 
+    def simd_pragmas(self):
+        """Pragmas for innermost loops when targeting an explicit SIMD width."""
+        width = int(self.backend.access.options.get("vector_width", 1))
+        if width > 1:
+            return [f"omp simd simdlen({width})"]
+        return None
+
     def generate(self, domain: basix.CellType):
         """Generate entire tabulate_tensor body.
 
@@ -170,12 +245,60 @@ class IntegralGenerator:
                 # element tensor
                 all_quadparts += self.generate_quadrature_loop(rule, cell)
 
-        # Collect parts before, during, and after quadrature loops
+        # Collect parts before, during, and after quadrature loops,
+        # preceded by the coefficient packing prologue requested while
+        # generating the partitions
+        parts += self.generate_packed_coefficient_scratch()
         parts += all_preparts
         parts += all_quadparts
 
+        # With symmetric assembly the quadrature loops only fill the
+        # upper triangle of the element tensor; complete it here
+        if self.ir.part == TensorPart.symmetric and len(self.ir.expression.tensor_shape) == 2:
+            parts += self.generate_symmetric_mirror()
+
         return L.StatementList(parts)
 
+    def generate_symmetric_mirror(self):
+        """Mirror the upper triangle of the element tensor into the lower.
+
+        Entries below the diagonal that were nevertheless computed in
+        the quadrature loops are overwritten with an equal value, by
+        symmetry of the form.
+        """
+        A = self.backend.symbols.element_tensor
+        A_shape = self.ir.expression.tensor_shape
+        assert A_shape[0] == A_shape[1]
+        i = self.backend.symbols.argument_loop_index(0)
+        j = self.backend.symbols.argument_loop_index(1)
+        body = [L.Assign(A[L.MultiIndex([j, i], A_shape)], A[L.MultiIndex([i, j], A_shape)])]
+        inner = L.ForRange(j, i + 1, A_shape[1], body, pragmas=self.simd_pragmas())
+        parts = [L.ForRange(i, 0, A_shape[0], [inner])]
+        return L.commented_code_list(parts, "Mirror the upper triangle of A into the lower")
+
+    def generate_packed_coefficient_scratch(self):
+        """Generate the prologue filling packed coefficient scratch arrays.
+
+        Block-strided coefficient dof reads registered through
+        FFCXBackendSymbols.coefficient_dof_access_blocked are gathered
+        once into contiguous scratch arrays here, so the dof-contraction
+        loops see unit-stride loads.
+        """
+        scratch = self.backend.symbols.packed_coefficient_scratch
+        if not scratch:
+            return []
+        align = int(self.backend.access.options.get("table_alignment", 0))
+        w = self.backend.symbols.coefficients
+        ic = self.backend.symbols.coefficient_dof_sum_index
+        parts: list[L.LNode] = []
+        for (coeff_offset, dof_offset), (sym, num_dofs, block_size) in sorted(scratch.items()):
+            body = [L.Assign(sym[ic], w[coeff_offset + ic * block_size + dof_offset])]
+            parts += [
+                L.ArrayDecl(sym, sizes=num_dofs, align=align),
+                L.ForRange(ic, 0, num_dofs, body, pragmas=self.simd_pragmas()),
+            ]
+        return L.commented_code_list(parts, "Pack strided coefficient dofs into contiguous scratch")
+
     def generate_quadrature_tables(self, domain: basix.CellType):
         """Generate static tables of quadrature points and weights."""
         parts: list[L.LNode] = []
@@ -264,9 +387,20 @@ class IntegralGenerator:
         these rotations.
 
         """
+        if self.table_pool is not None:
+            self.backend.symbols.element_tables[name] = self.table_pool.symbol(table)
+            return []
+        options = self.backend.access.options
         table_symbol = L.Symbol(name, dtype=L.DataType.REAL)
         self.backend.symbols.element_tables[name] = table_symbol
-        return [L.ArrayDecl(table_symbol, values=table, const=True)]
+        return [
+            L.ArrayDecl(
+                table_symbol,
+                values=pad_table(table, options),
+                const=True,
+                align=int(options.get("table_alignment", 0)),
+            )
+        ]
 
     def generate_quadrature_loop(self, quadrature_rule: QuadratureRule, domain: basix.CellType):
         """Generate quadrature loop with for this quadrature_rule."""
@@ -299,7 +433,38 @@ class IntegralGenerator:
         code = definitions + intermediates + tensor_comp
         code = optimize(code, quadrature_rule)
 
-        return [L.create_nested_for_loops([iq], code)]
+        # For rank-1 kernels, e.g. the action of a bilinear form on a
+        # coefficient, each block contribution accumulates into the
+        # output vector with a loop over the same argument dofs. Fuse
+        # these into a single sweep per quadrature point, so the
+        # coefficient contraction feeds the output accumulation directly
+        # without per-block outer-product loops.
+        if len(self.ir.expression.tensor_shape) == 1 and self.ir.part == TensorPart.full:
+            code = fuse_sections(code, "Tensor Computation")
+            for i, section in enumerate(code):
+                if isinstance(section, L.Section) and section.name == "Tensor Computation":
+                    code[i] = fuse_loops(section)
+
+        # Overlap the hoisted temporary arrays of different sections in
+        # a small arena to bound the kernel's stack footprint
+        code = reuse_arrays(code)
+
+        parts = [L.create_nested_for_loops([iq], code)]
+
+        # Unroll short quadrature loops and jam the argument-dof loops
+        # of the unrolled iterations
+        threshold = int(self.backend.access.options.get("unroll_threshold", 0))
+        if self.ir.expression.integral_type in ("vertex", "ridge"):
+            # Vertex and ridge integrals evaluate at one or a few points
+            # per entity, so always collapse their quadrature loops: the
+            # kernel becomes straight-line code with constant indices
+            # into the point-evaluation tables, and the loop overhead no
+            # longer dominates the little work done per entity
+            threshold = max(threshold, 4)
+        if threshold > 0:
+            parts = unroll_loops(parts, threshold)
+
+        return parts
 
     def generate_piecewise_partition(self, quadrature_rule, domain: basix.CellType):
         """Generate a piecewise partition."""
@@ -566,11 +731,45 @@ class IntegralGenerator:
         for indices in keep:
             multi_index = L.MultiIndex(list(indices), A_shape)
             for expression in keep[indices]:
+                # Skip stores of structurally zero contributions
+                if L.is_zero_lexpr(expression):
+                    continue
                 body.append(L.AssignAdd(A[multi_index], expression))
 
+        # For a symmetric bilinear form, restrict blocks whose axes
+        # share the same dofmap to the upper triangle; the lower
+        # triangle of the element tensor is filled by a mirror copy
+        # after the quadrature loops. Blocks with distinct dofmaps stay
+        # full, so their transposed partners are never left unwritten.
+        symmetric_triangle = (
+            self.ir.part == TensorPart.symmetric
+            and block_rank == 2
+            and blockmap[0] == blockmap[1]
+            and all(index.dim == 1 for index in B_indices)
+            and all(
+                bd.ma_data[0].tabledata.block_size == bd.ma_data[1].tabledata.block_size
+                for bd in blocklist
+            )
+        )
+
         # reverse B_indices
         B_indices = B_indices[::-1]
-        body = [L.create_nested_for_loops(B_indices, body)]
+        if symmetric_triangle:
+            # Outer loop over the trial dof j, inner loop over the test
+            # dofs i <= j. Component offsets within an interleaved block
+            # may put the i == j entry just below the diagonal; it is
+            # computed anyway and overwritten by the mirror copy.
+            j_index, i_index = B_indices
+            inner = L.ForRange(
+                i_index.symbols[0],
+                0,
+                j_index.symbols[0] + 1,
+                body,
+                pragmas=self.simd_pragmas(),
+            )
+            body = [L.ForRange(j_index.symbols[0], 0, j_index.sizes[0], [inner])]
+        else:
+            body = [L.create_nested_for_loops(B_indices, body, pragmas=self.simd_pragmas())]
         input = [*vars, *tables]
         output = [A]
 
@@ -7,6 +7,7 @@
 
 from __future__ import annotations
 
+import concurrent.futures
 import importlib
 import io
 import logging
@@ -24,8 +25,16 @@ import numpy as np
 import numpy.typing as npt
 import ufl
 
+try:
+    import fcntl
+except ImportError:
+    # Advisory file locks are not available on Windows; the cache falls
+    # back to polling for the ready marker
+    fcntl = None  # type: ignore
+
 import ffcx
 import ffcx.naming
+from ffcx import profiling
 from ffcx.codegeneration.C.file_template import libraries as _libraries
 
 logger = logging.getLogger("ffcx")
@@ -69,6 +78,19 @@ UFC_INTEGRAL_DECL += "\n".join(
     re.findall(r"typedef void ?\(ufcx_tabulate_tensor_complex128\).*?\);", ufcx_h, re.DOTALL)
 )
 
+UFC_INTEGRAL_DECL += "\n".join(
+    re.findall(r"typedef void ?\(ufcx_tabulate_tensor_batch_float32\).*?\);", ufcx_h, re.DOTALL)
+)
+UFC_INTEGRAL_DECL += "\n".join(
+    re.findall(r"typedef void ?\(ufcx_tabulate_tensor_batch_float64\).*?\);", ufcx_h, re.DOTALL)
+)
+UFC_INTEGRAL_DECL += "\n".join(
+    re.findall(r"typedef void ?\(ufcx_tabulate_tensor_batch_complex64\).*?\);", ufcx_h, re.DOTALL)
+)
+UFC_INTEGRAL_DECL += "\n".join(
+    re.findall(r"typedef void ?\(ufcx_tabulate_tensor_batch_complex128\).*?\);", ufcx_h, re.DOTALL)
+)
+
 UFC_INTEGRAL_DECL += "\n".join(
     re.findall("typedef struct ufcx_integral.*?ufcx_integral;", ufcx_h, re.DOTALL)
 )
@@ -84,7 +106,21 @@ def _compute_option_signature(options):
 
 
 def get_cached_module(module_name, object_names, cache_dir, timeout):
-    """Look for an existing C file and wait for compilation, or if it does not exist, create it."""
+    """Look for an existing compiled module, or obtain the right to compile it.
+
+    Returns a triple (objects, module, lock). If the module is available in
+    the cache, (objects, module, None) is returned. Otherwise the caller
+    holds an exclusive advisory lock on the module and must compile it,
+    create the ready marker and then release the lock. Other processes
+    racing for the same module retry the lock with short sleeps for up to
+    timeout seconds, so a writer that crashes while holding the lock (on
+    NFS) or wedges cannot block readers forever, and raise TimeoutError
+    once the budget is spent.
+
+    On platforms without advisory locks the previous protocol is used:
+    exclusive creation of the C file marks the writer and other processes
+    poll for the ready marker for up to timeout seconds.
+    """
     cache_dir = Path(cache_dir)
     c_filename = cache_dir.joinpath(module_name).with_suffix(".c")
     ready_name = c_filename.with_suffix(".c.cached")
@@ -92,30 +128,59 @@ def get_cached_module(module_name, object_names, cache_dir, timeout):
     # Ensure cache dir exists
     cache_dir.mkdir(exist_ok=True, parents=True)
 
+    if fcntl is None:
+        return _get_cached_module_polling(module_name, object_names, cache_dir, timeout)
+
+    lock = open(cache_dir.joinpath(module_name + ".lock"), "a")
+    deadline = time.time() + timeout
+    waiting = False
+    while True:
+        try:
+            fcntl.flock(lock, fcntl.LOCK_EX | fcntl.LOCK_NB)
+        except OSError:
+            # Another process is compiling this module; retry until the
+            # writer releases the lock, honoring the timeout
+            if not waiting:
+                logger.info(f"Waiting for {module_name} to be compiled by another process.")
+                waiting = True
+            if time.time() > deadline:
+                lock.close()
+                raise TimeoutError(
+                    "JIT compilation timed out while waiting for another process "
+                    f"to compile {module_name}. Try cleaning the cache (e.g. remove "
+                    f"{c_filename}) or increase the timeout option."
+                )
+            time.sleep(0.1)
+            continue
+
+        if os.path.exists(ready_name):
+            # Module was compiled by an earlier run
+            lock.close()
+            return (*_load_objects(cache_dir, module_name, object_names), None)
+
+        # We are the writer: leave the C file marker and keep the
+        # exclusive lock until compilation has finished
+        open(c_filename, "w").close()
+        return None, None, lock
+
+
+def _get_cached_module_polling(module_name, object_names, cache_dir, timeout):
+    """Wait for a cached module by polling for the ready marker."""
+    c_filename = cache_dir.joinpath(module_name).with_suffix(".c")
+    ready_name = c_filename.with_suffix(".c.cached")
+
     try:
         # Create C file with exclusive access
         with open(c_filename, "x"):
             pass
-        return None, None
+        return None, None, None
     except FileExistsError:
         logger.info("Cached C file already exists: " + str(c_filename))
-        finder = importlib.machinery.FileFinder(
-            str(cache_dir),
-            (importlib.machinery.ExtensionFileLoader, importlib.machinery.EXTENSION_SUFFIXES),
-        )
-        finder.invalidate_caches()
 
         # Now, wait for ready
         for i in range(timeout):
             if os.path.exists(ready_name):
-                spec = finder.find_spec(module_name)
-                if spec is None:
-                    raise ModuleNotFoundError("Unable to find JIT module.")
-                compiled_module = importlib.util.module_from_spec(spec)
-                spec.loader.exec_module(compiled_module)
-
-                compiled_objects = [getattr(compiled_module.lib, name) for name in object_names]
-                return compiled_objects, compiled_module
+                return (*_load_objects(cache_dir, module_name, object_names), None)
 
             logger.info(f"Waiting for {ready_name} to appear.")
             time.sleep(1)
@@ -125,6 +190,23 @@ def get_cached_module(module_name, object_names, cache_dir, timeout):
         )
 
 
+def _compile_translation_unit(source_path, include_dirs, compile_args, output_dir):
+    """Compile a single C translation unit to an object file."""
+    import setuptools  # noqa: F401  (provides distutils on Python >= 3.12)
+    from distutils.ccompiler import new_compiler
+    from distutils.sysconfig import customize_compiler
+
+    compiler = new_compiler()
+    customize_compiler(compiler)
+    objects = compiler.compile(
+        [str(source_path)],
+        output_dir=str(output_dir),
+        include_dirs=include_dirs,
+        extra_postargs=compile_args,
+    )
+    return objects[0]
+
+
 def _compilation_signature(cffi_extra_compile_args, cffi_debug):
     """Compute the compilation-inputs part of the signature.
 
@@ -159,6 +241,9 @@ def compile_forms(
     cffi_debug: bool = False,
     cffi_libraries: list[str] = [],
     visualise: bool = False,
+    parallel: int = 1,
+    codegen_workers: int = 1,
+    baked_constants: dict | None = None,
 ):
     """Compile a list of UFL forms into UFC Python objects.
 
@@ -172,9 +257,27 @@ def compile_forms(
         cffi_debug: Use compiler debug mode
         cffi_libraries: libraries to use with compiler
         visualise: Toggle visualisation
+        parallel: Maximum number of concurrent C compiler invocations.
+            Values > 1 place each integral in its own translation unit,
+            compile the units concurrently and link them into one module.
+        codegen_workers: Number of worker processes for the code
+            generation stage. Values > 1 generate the integral, form and
+            expression IRs concurrently; element tables are then declared
+            in-kernel instead of pooled at file scope.
+        baked_constants: Map from Constants appearing in the forms to
+            fixed values. The values are folded into the generated code
+            as literals, so the baked constants drop out of the runtime
+            c array. The literals are part of the form signature, hence
+            different values compile to different cached modules.
     """
     p = ffcx.options.get_options(options)
 
+    # Fold user-fixed constant values into the forms as literals
+    if baked_constants:
+        from ffcx.specialization import bake_constants
+
+        forms = [bake_constants(form, baked_constants) for form in forms]
+
     # If requested, replace bi-linear forms by their diagonal part
     if p["part"] == "diagonal":
         for i, form in enumerate(forms):
@@ -202,9 +305,10 @@ def compile_forms(
 
     form_names = [ffcx.naming.form_name(form, i, module_name) for i, form in enumerate(forms)]
 
+    module_lock = None
     if cache_dir is not None:
         cache_dir = Path(cache_dir)
-        obj, mod = get_cached_module(module_name, form_names, cache_dir, timeout)
+        obj, mod, module_lock = get_cached_module(module_name, form_names, cache_dir, timeout)
         if obj is not None:
             return obj, mod, (None, None)
     else:
@@ -233,6 +337,8 @@ def compile_forms(
             cffi_debug,
             cffi_libraries,
             visualise=visualise,
+            parallel=parallel,
+            codegen_workers=codegen_workers,
         )
     except Exception as e:
         try:
@@ -242,6 +348,10 @@ def compile_forms(
         except Exception:
             pass
         raise e
+    finally:
+        # Wake up any processes blocked on this module
+        if module_lock is not None:
+            module_lock.close()
 
     obj, module = _load_objects(cache_dir, module_name, form_names)
     return obj, module, (decl, impl)
@@ -257,6 +367,8 @@ def compile_expressions(
     cffi_debug: bool = False,
     cffi_libraries: list[str] = [],
     visualise: bool = False,
+    parallel: int = 1,
+    codegen_workers: int = 1,
 ):
     """Compile a list of UFL expressions into UFC Python objects.
 
@@ -270,6 +382,13 @@ def compile_expressions(
         cffi_debug: Use compiler debug mode
         cffi_libraries: libraries to use with compiler
         visualise: Toggle visualisation
+        parallel: Maximum number of concurrent C compiler invocations.
+            Values > 1 place each integral in its own translation unit,
+            compile the units concurrently and link them into one module.
+        codegen_workers: Number of worker processes for the code
+            generation stage. Values > 1 generate the integral, form and
+            expression IRs concurrently; element tables are then declared
+            in-kernel instead of pooled at file scope.
     """
     p = ffcx.options.get_options(options)
 
@@ -281,9 +400,10 @@ def compile_expressions(
         ffcx.naming.expression_name(expression, module_name) for expression in expressions
     ]
 
+    module_lock = None
     if cache_dir is not None:
         cache_dir = Path(cache_dir)
-        obj, mod = get_cached_module(module_name, expr_names, cache_dir, timeout)
+        obj, mod, module_lock = get_cached_module(module_name, expr_names, cache_dir, timeout)
         if obj is not None:
             return obj, mod, (None, None)
     else:
@@ -313,6 +433,8 @@ def compile_expressions(
             cffi_debug,
             cffi_libraries,
             visualise=visualise,
+            parallel=parallel,
+            codegen_workers=codegen_workers,
         )
     except Exception as e:
         try:
@@ -322,6 +444,10 @@ def compile_expressions(
         except Exception:
             pass
         raise e
+    finally:
+        # Wake up any processes blocked on this module
+        if module_lock is not None:
+            module_lock.close()
 
     obj, module = _load_objects(cache_dir, module_name, expr_names)
     return obj, module, (decl, impl)
@@ -339,6 +465,8 @@ def _compile_objects(
     cffi_debug,
     cffi_libraries,
     visualise: bool = False,
+    parallel: int = 1,
+    codegen_workers: int = 1,
 ):
     import ffcx.compiler
 
@@ -346,9 +474,27 @@ def _compile_objects(
 
     # JIT uses module_name as prefix, which is needed to make names of all struct/function
     # unique across modules
-    _, code_body = ffcx.compiler.compile_ufl_objects(
-        ufl_objects, prefix=module_name, options=options, visualise=visualise
-    )
+    tu_sources: list[str] = []
+    if parallel > 1:
+        _, sources = ffcx.compiler.compile_ufl_objects(
+            ufl_objects,
+            prefix=module_name,
+            options=options,
+            visualise=visualise,
+            split_integrals=True,
+            ir_cache_dir=cache_dir,
+            codegen_workers=codegen_workers,
+        )
+        code_body, tu_sources = sources[0], sources[1:]
+    else:
+        _, code_body = ffcx.compiler.compile_ufl_objects(
+            ufl_objects,
+            prefix=module_name,
+            options=options,
+            visualise=visualise,
+            ir_cache_dir=cache_dir,
+            codegen_workers=codegen_workers,
+        )
 
     # Raise error immediately prior to compilation if no support for C99
     # _Complex. Doing this here allows FFCx to be used for complex codegen on
@@ -365,8 +511,39 @@ def _compile_objects(
     else:
         cffi_base_compile_args = ["-std=c17"]
 
+    # The SIMD pragmas emitted for vector_width > 1 are only honored
+    # when the compiler processes OpenMP SIMD directives
+    if int(options.get("vector_width", 1)) > 1 and not sys.platform.startswith("win32"):
+        cffi_base_compile_args.append("-fopenmp-simd")
+
     cffi_final_compile_args = cffi_base_compile_args + cffi_extra_compile_args
 
+    # Compile the per-integral translation units concurrently. The C
+    # compiler runs as a subprocess, so a thread pool gives full
+    # concurrency; the object files are linked into the module below.
+    extra_objects: list[str] = []
+    if tu_sources:
+        cache_dir.mkdir(exist_ok=True, parents=True)
+        tu_paths = []
+        for i, source in enumerate(tu_sources):
+            tu_path = cache_dir.joinpath(f"{module_name}_tu{i}.c")
+            tu_path.write_text(source)
+            tu_paths.append(tu_path)
+        logger.info(
+            f"Compiling {len(tu_paths)} integral translation units "
+            f"with up to {parallel} concurrent compilers"
+        )
+        include_dirs = [ffcx.codegeneration.get_include_path()]
+        with concurrent.futures.ThreadPoolExecutor(max_workers=parallel) as pool:
+            extra_objects = list(
+                pool.map(
+                    lambda path: _compile_translation_unit(
+                        path, include_dirs, cffi_final_compile_args, cache_dir
+                    ),
+                    tu_paths,
+                )
+            )
+
     ffibuilder = cffi.FFI()
 
     ffibuilder.set_source(
@@ -375,6 +552,7 @@ def _compile_objects(
         include_dirs=[ffcx.codegeneration.get_include_path()],
         extra_compile_args=cffi_final_compile_args,
         libraries=libraries,
+        extra_objects=extra_objects,
     )
 
     ffibuilder.cdef(decl)
@@ -403,6 +581,10 @@ def _compile_objects(
 
     logger.info(f"JIT C compiler finished in {time.time() - t0:.4f}")
 
+    if options.get("profile_file"):
+        profiling.record_stage("c_compiler", time.time() - t0)
+        profiling.write(options["profile_file"])
+
     # Create a "status ready" file. If this fails, it is an error,
     # because it should not exist yet.
     # Copy the stdout verbose output of the build into the ready file
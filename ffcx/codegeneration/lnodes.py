@@ -971,12 +971,15 @@ class ArrayDecl(Declaration):
 
     """
 
-    def __init__(self, symbol, sizes=None, values=None, const=False):
+    def __init__(self, symbol, sizes=None, values=None, const=False, align=0):
         """Initialise."""
         assert isinstance(symbol, Symbol)
         self.symbol = symbol
         assert symbol.dtype
 
+        # Requested byte alignment of the array, or 0 for the default
+        self.align = align
+
         if sizes is None:
             assert values is not None
             sizes = values.shape
@@ -1027,9 +1030,13 @@ def depth(code) -> int:
 
 
 class ForRange(Statement):
-    """Slightly higher-level for loop assuming incrementing an index over a range."""
+    """Slightly higher-level for loop assuming incrementing an index over a range.
+
+    Pragmas (plain strings without the leading "#pragma") are emitted
+    immediately before the loop by the target language formatter.
+    """
 
-    def __init__(self, index, begin, end, body):
+    def __init__(self, index, begin, end, body, pragmas=None):
         """Initialise."""
         assert isinstance(index, Symbol) or isinstance(index, MultiIndex)
         self.index = index
@@ -1037,6 +1044,7 @@ class ForRange(Statement):
         self.end = as_lexpr(end)
         assert isinstance(body, list)
         self.body = StatementList(body)
+        self.pragmas = pragmas or []
 
     def as_tuple(self):
         """Convert to a tuple."""
@@ -1123,15 +1131,17 @@ def ufl_to_lnodes(operator, *args):
         raise RuntimeError(f"Missing lookup for expr type {optype}.")
 
 
-def create_nested_for_loops(indices: list[MultiIndex], body):
+def create_nested_for_loops(indices: list[MultiIndex], body, pragmas=None):
     """Create nested for loops over list of indices.
 
     The depth of the nested for loops is equal to the sub-indices for all
-    MultiIndex combined.
+    MultiIndex combined. Optional pragmas are attached to the innermost
+    loop only.
     """
     ranges = [r for idx in indices for r in idx.sizes]
     indices = [idx.local_index(i) for idx in indices for i in range(len(idx.sizes))]
     depth = len(ranges)
     for i in reversed(range(depth)):
-        body = ForRange(indices[i], 0, ranges[i], body=[body])
+        body = ForRange(indices[i], 0, ranges[i], body=[body], pragmas=pragmas)
+        pragmas = None
     return body
@@ -1,5 +1,6 @@
 """Optimizer."""
 
+import copy
 from collections import defaultdict
 
 import ffcx.codegeneration.lnodes as L
@@ -21,6 +22,8 @@ def optimize(code: list[L.LNode], quadrature_rule: QuadratureRule) -> list[L.LNo
     code = fuse_sections(code, "Jacobian")
     for i, section in enumerate(code):
         if isinstance(section, L.Section):
+            if section.name == "Intermediates":
+                section = cse(section)
             if L.Annotation.fuse in section.annotations:
                 section = fuse_loops(section)
             if L.Annotation.licm in section.annotations:
@@ -30,6 +33,138 @@ def optimize(code: list[L.LNode], quadrature_rule: QuadratureRule) -> list[L.LNo
     return code
 
 
+def expression_key(expr: L.LExpr) -> tuple:
+    """Compute a structural key identifying an expression tree.
+
+    Args:
+        expr: Expression to compute a key for.
+
+    Returns:
+        Hashable key; two expressions with equal keys generate the same code.
+    """
+    if isinstance(expr, L.Symbol):
+        return ("Symbol", expr.name)
+    elif isinstance(expr, L.LiteralFloat | L.LiteralInt):
+        return ("Literal", repr(expr.value))
+    elif isinstance(expr, L.MultiIndex):
+        symbols = tuple(expression_key(sym) for sym in expr.symbols)
+        return ("MultiIndex", symbols, tuple(str(size) for size in expr.sizes))
+    elif isinstance(expr, L.ArrayAccess):
+        indices = tuple(expression_key(i) for i in expr.indices)
+        return ("ArrayAccess", expression_key(expr.array), indices)
+    elif isinstance(expr, L.PrefixUnaryOp):
+        return (type(expr).__name__, expression_key(expr.arg))
+    elif isinstance(expr, L.MathFunction):
+        return ("MathFunction", expr.function, tuple(expression_key(arg) for arg in expr.args))
+    elif isinstance(expr, L.NaryOp):
+        return (type(expr).__name__, tuple(expression_key(arg) for arg in expr.args))
+    elif isinstance(expr, L.Conditional):
+        return (
+            "Conditional",
+            expression_key(expr.condition),
+            expression_key(expr.true),
+            expression_key(expr.false),
+        )
+    elif isinstance(expr, L.BinOp):
+        return (type(expr).__name__, expression_key(expr.lhs), expression_key(expr.rhs))
+    else:
+        # Unknown node: never considered equal to anything else
+        return ("Opaque", id(expr))
+
+
+def cse(section: L.Section) -> L.Section:
+    """Eliminate common subexpressions in a section by hash-consing.
+
+    Repeated floating point subtrees in the right-hand sides of the
+    section's assignments are materialized as scalar temporaries,
+    declared in the section scope and assigned just before the statement
+    that first uses them. Subtrees are identified structurally, so the
+    same product or sum written out several times collapses onto one
+    temporary. Statements assign to fresh symbols in order, hence a
+    subtree is always computable at its first point of use.
+
+    Args:
+        section: Section to optimize.
+
+    Returns:
+        Section with repeated subexpressions materialized as temporaries.
+    """
+
+    def is_candidate(expr: L.LExpr) -> bool:
+        # Only materialize nodes that actually cost flops
+        if not isinstance(expr, L.ArithmeticBinOp | L.NaryOp | L.MathFunction | L.Neg):
+            return False
+        return expr.dtype in (L.DataType.SCALAR, L.DataType.REAL)
+
+    counts: dict[tuple, int] = defaultdict(int)
+
+    def count(expr: L.LExpr) -> None:
+        if is_candidate(expr):
+            counts[expression_key(expr)] += 1
+        if isinstance(expr, L.PrefixUnaryOp):
+            count(expr.arg)
+        elif isinstance(expr, L.NaryOp | L.MathFunction):
+            for arg in expr.args:
+                count(arg)
+        elif isinstance(expr, L.Conditional):
+            count(expr.condition)
+            count(expr.true)
+            count(expr.false)
+        elif isinstance(expr, L.BinOp):
+            count(expr.lhs)
+            count(expr.rhs)
+
+    for statement in section.statements:
+        expr = statement.expr if isinstance(statement, L.Statement) else statement
+        if isinstance(expr, L.AssignOp):
+            count(expr.rhs)
+
+    temps: dict[tuple, L.Symbol] = {}
+    declarations = list(section.declarations)
+    counter = 0
+
+    def rebuild(expr: L.LExpr, pre: list[L.LNode]) -> L.LExpr:
+        nonlocal counter
+        # The key must be taken before children are replaced by temporaries
+        key = expression_key(expr) if is_candidate(expr) else None
+
+        if isinstance(expr, L.PrefixUnaryOp):
+            expr.arg = rebuild(expr.arg, pre)
+        elif isinstance(expr, L.NaryOp | L.MathFunction):
+            expr.args = [rebuild(arg, pre) for arg in expr.args]
+        elif isinstance(expr, L.Conditional):
+            expr.condition = rebuild(expr.condition, pre)
+            expr.true = rebuild(expr.true, pre)
+            expr.false = rebuild(expr.false, pre)
+        elif isinstance(expr, L.BinOp):
+            expr.lhs = rebuild(expr.lhs, pre)
+            expr.rhs = rebuild(expr.rhs, pre)
+
+        if key is not None and counts[key] > 1:
+            temp = temps.get(key)
+            if temp is None:
+                temp = L.Symbol(f"cse_{counter}", dtype=expr.dtype)
+                counter += 1
+                declarations.append(L.VariableDecl(temp, 0))
+                pre.append(L.Assign(temp, expr))
+                temps[key] = temp
+            return temp
+        return expr
+
+    statements: list[L.LNode] = []
+    for statement in section.statements:
+        expr = statement.expr if isinstance(statement, L.Statement) else statement
+        if isinstance(expr, L.AssignOp):
+            pre: list[L.LNode] = []
+            expr.rhs = rebuild(expr.rhs, pre)
+            statements.extend(pre)
+        statements.append(statement)
+
+    return L.Section(
+        section.name, statements, declarations, section.input, section.output, section.annotations
+    )
+
+
 def fuse_sections(code: list[L.LNode], name: str) -> list[L.LNode]:
     """Fuse sections with the same name.
 
@@ -87,17 +222,221 @@ def fuse_loops(code: L.Section) -> L.Section:
     output_code = []
     for statement in code.statements:
         if isinstance(statement, L.ForRange):
-            id = (statement.index, statement.begin, statement.end)
+            id = (statement.index, statement.begin, statement.end, tuple(statement.pragmas))
             loops[id].append(statement.body)
         else:
             output_code.append(statement)
 
-    for range, body in loops.items():
-        output_code.append(L.ForRange(*range, body))
+    for (index, begin, end, pragmas), body in loops.items():
+        output_code.append(L.ForRange(index, begin, end, body, pragmas=list(pragmas)))
 
     return L.Section(code.name, output_code, code.declarations, code.input, code.output)
 
 
+def reuse_arrays(code: list[L.LNode]) -> list[L.LNode]:
+    """Share storage between temporary arrays with disjoint lifetimes.
+
+    The scalar temporary arrays introduced by licm are only referenced
+    inside the section that declared them, so arrays from different
+    sections are never live at the same time and can overlap in one
+    arena. Walking the sections in order, the k-th array of each
+    section is assigned to arena slot k and the slot grows to the
+    largest size assigned to it. The per-section declarations are
+    dropped and one declaration per slot is placed ahead of the first
+    section, bounding the stack footprint by the busiest section
+    instead of the sum over all sections.
+
+    Args:
+        code: List of LNodes to optimize.
+
+    Returns:
+        List of LNodes with temporary arrays mapped onto the arena.
+    """
+    arena: list[int] = []
+    for section in code:
+        if not isinstance(section, L.Section):
+            continue
+        statements = []
+        slot = 0
+        for statement in section.statements:
+            if (
+                isinstance(statement, L.ArrayDecl)
+                and statement.symbol.dtype == L.DataType.SCALAR
+                and statement.symbol.name.startswith("temp_")
+            ):
+                if slot == len(arena):
+                    arena.append(0)
+                arena[slot] = max(arena[slot], statement.sizes[0])
+                # All uses reference the declared Symbol object, so
+                # renaming it redirects them to the arena slot
+                statement.symbol.name = f"temp_arena_{slot}"
+                slot += 1
+                continue
+            statements.append(statement)
+        section.statements = statements
+
+    if arena:
+        decls: list[L.LNode] = [
+            L.ArrayDecl(L.Symbol(f"temp_arena_{i}", dtype=L.DataType.SCALAR), size, [0])
+            for i, size in enumerate(arena)
+        ]
+        code = decls + code
+
+    return code
+
+
+def _substitute(expr: L.LExpr, index: L.Symbol, value: L.LExpr) -> L.LExpr:
+    """Replace occurrences of index in an expression tree, in place."""
+    if isinstance(expr, L.Symbol):
+        return value if expr == index else expr
+    if isinstance(expr, L.ArrayAccess):
+        expr.indices = tuple(_substitute(i, index, value) for i in expr.indices)
+    elif isinstance(expr, L.MultiIndex):
+        expr.symbols = [_substitute(s, index, value) for s in expr.symbols]
+        expr.global_index = _substitute(expr.global_index, index, value)
+    elif isinstance(expr, L.PrefixUnaryOp):
+        expr.arg = _substitute(expr.arg, index, value)
+    elif isinstance(expr, L.NaryOp | L.MathFunction):
+        expr.args = [_substitute(arg, index, value) for arg in expr.args]
+    elif isinstance(expr, L.Conditional):
+        expr.condition = _substitute(expr.condition, index, value)
+        expr.true = _substitute(expr.true, index, value)
+        expr.false = _substitute(expr.false, index, value)
+    elif isinstance(expr, L.BinOp):
+        expr.lhs = _substitute(expr.lhs, index, value)
+        expr.rhs = _substitute(expr.rhs, index, value)
+    return expr
+
+
+def _substitute_in_statement(statement: L.LNode, index: L.Symbol, value: L.LExpr) -> None:
+    """Replace occurrences of index in a statement tree, in place."""
+    if isinstance(statement, L.Section):
+        for decl in statement.declarations:
+            if isinstance(decl, L.VariableDecl) and decl.value is not None:
+                decl.value = _substitute(decl.value, index, value)
+        for s in statement.statements:
+            _substitute_in_statement(s, index, value)
+    elif isinstance(statement, L.StatementList):
+        for s in statement.statements:
+            _substitute_in_statement(s, index, value)
+    elif isinstance(statement, L.ForRange):
+        statement.begin = _substitute(statement.begin, index, value)
+        statement.end = _substitute(statement.end, index, value)
+        _substitute_in_statement(statement.body, index, value)
+    elif isinstance(statement, L.VariableDecl):
+        if statement.value is not None:
+            statement.value = _substitute(statement.value, index, value)
+    elif isinstance(statement, L.Comment | L.ArrayDecl):
+        pass
+    elif isinstance(statement, L.Statement):
+        statement.expr = _substitute(statement.expr, index, value)
+
+
+def _rename_declarations(statement: L.LNode, postfix: str) -> None:
+    """Rename the symbols declared inside an unrolled loop body copy.
+
+    Declarations and their uses share Symbol objects, so renaming the
+    declared symbol redirects every use inside the copy and keeps the
+    copies from clashing in the enclosing scope.
+    """
+    if isinstance(statement, L.Section):
+        for decl in statement.declarations:
+            decl.symbol.name = f"{decl.symbol.name}_{postfix}"
+        for s in statement.statements:
+            _rename_declarations(s, postfix)
+    elif isinstance(statement, L.StatementList):
+        for s in statement.statements:
+            _rename_declarations(s, postfix)
+    elif isinstance(statement, L.ForRange):
+        _rename_declarations(statement.body, postfix)
+    elif isinstance(statement, L.ArrayDecl | L.VariableDecl):
+        statement.symbol.name = f"{statement.symbol.name}_{postfix}"
+
+
+def _fuse_loop_body(loop: L.ForRange) -> L.ForRange:
+    """Fuse the body of a jammed loop when it holds identical inner loops."""
+    body = loop.body.statements
+    if len(body) > 1 and all(isinstance(s, L.ForRange) for s in body):
+        key = (body[0].index, body[0].begin, body[0].end, tuple(body[0].pragmas))
+        if all((s.index, s.begin, s.end, tuple(s.pragmas)) == key for s in body[1:]):
+            inner = L.ForRange(
+                body[0].index,
+                body[0].begin,
+                body[0].end,
+                [st for s in body for st in s.body.statements],
+                pragmas=list(body[0].pragmas),
+            )
+            loop.body = L.StatementList([_fuse_loop_body(inner)])
+    return loop
+
+
+def unroll_loops(code: list[L.LNode], threshold: int) -> list[L.LNode]:
+    """Fully unroll short quadrature loops and jam the argument-dof loops.
+
+    Loops with a literal trip count of at most threshold are replaced by
+    one copy of the body per iteration, with the loop index substituted
+    by its literal value and the symbols declared inside each copy
+    renamed, so element table and weight accesses become constant-indexed
+    and the loop overhead disappears. The element tensor accumulation
+    sections of all copies only read the unrolled intermediates, so they
+    are moved behind them and fused onto a single argument-dof loop nest
+    shared by all quadrature points (unroll-and-jam).
+
+    Args:
+        code: List of LNodes to optimize.
+        threshold: Largest trip count that is unrolled.
+
+    Returns:
+        List of LNodes with qualifying loops unrolled.
+    """
+    output: list[L.LNode] = []
+    for statement in code:
+        if not (
+            isinstance(statement, L.ForRange)
+            and isinstance(statement.index, L.Symbol)
+            and isinstance(statement.begin, L.LiteralInt)
+            and isinstance(statement.end, L.LiteralInt)
+            and 0 < statement.end.value - statement.begin.value <= threshold
+        ):
+            output.append(statement)
+            continue
+
+        trip_count = statement.end.value - statement.begin.value
+        unrolled: list[L.LNode] = []
+        for value in range(statement.begin.value, statement.end.value):
+            body = copy.deepcopy(statement.body.statements)
+            for s in body:
+                _substitute_in_statement(s, statement.index, L.LiteralInt(value))
+                # A single copy cannot clash with itself
+                if trip_count > 1:
+                    _rename_declarations(s, f"q{value}")
+            unrolled.extend(body)
+
+        # Jam the per-iteration element tensor accumulation sections
+        stores: list[L.LNode] = []
+        rest: list[L.LNode] = []
+        for s in unrolled:
+            if isinstance(s, L.Section) and s.name == "Tensor Computation":
+                stores.append(s)
+            else:
+                rest.append(s)
+        if len(stores) > 1:
+            jammed = fuse_sections(rest + stores, "Tensor Computation")
+            for i, s in enumerate(jammed):
+                if isinstance(s, L.Section) and s.name == "Tensor Computation":
+                    s = fuse_loops(s)
+                    s.statements = [
+                        _fuse_loop_body(st) if isinstance(st, L.ForRange) else st
+                        for st in s.statements
+                    ]
+                    jammed[i] = s
+            output.extend(jammed)
+        else:
+            output.extend(unrolled)
+
+    return output
+
+
 def get_statements(statement: L.Statement | L.StatementList) -> list[L.LNode]:
     """Get statements from a statement list.
 
@@ -76,6 +76,12 @@ class FFCXBackendSymbols:
         self.quadrature_weight_tables = {}
         self.element_tables = {}
 
+        # Packed coefficient scratch blocks requested through
+        # coefficient_dof_access_blocked, keyed by (coefficient offset,
+        # dof offset); the kernel generator emits a packing prologue
+        # filling each block once per kernel
+        self.packed_coefficient_scratch = {}
+
         # Reusing a single symbol for all quadrature loops, assumed not to be nested.
         self.quadrature_loop_index = L.Symbol("iq", dtype=L.DataType.INT)
 
@@ -158,12 +164,19 @@ class FFCXBackendSymbols:
         return w[offset + dof_index]
 
     def coefficient_dof_access_blocked(
-        self, coefficient: ufl.Coefficient, index, block_size, dof_offset
+        self, coefficient: ufl.Coefficient, index, block_size, dof_offset, num_dofs
     ):
-        """Blocked coefficient DOF access."""
+        """Blocked coefficient DOF access.
+
+        Returns a unit-stride access into a packed scratch array together
+        with the equivalent strided access into w. The scratch block is
+        recorded in packed_coefficient_scratch so the kernel generator
+        can emit a prologue filling it once per kernel.
+        """
         coeff_offset = self.coefficient_offsets[coefficient]
         w = self.coefficients
         _w = L.Symbol(f"_w_{coeff_offset}_{dof_offset}", dtype=L.DataType.SCALAR)
+        self.packed_coefficient_scratch[(coeff_offset, dof_offset)] = (_w, num_dofs, block_size)
         unit_stride_access = _w[index]
         original_access = w[coeff_offset + index * block_size + dof_offset]
         return unit_stride_access, original_access
@@ -100,7 +100,7 @@ extern "C"
   /// Tabulate integral into tensor A with compiled
   /// quadrature rule and double precision
   ///
-  /// @see ufcx_tabulate_tensor_single
+  /// @see ufcx_tabulate_tensor_float32
   typedef void(ufcx_tabulate_tensor_float64)(
       double* restrict A, const double* restrict w, const double* restrict c,
       const double* restrict coordinate_dofs,
@@ -111,7 +111,7 @@ extern "C"
   /// Tabulate integral into tensor A with compiled
   /// quadrature rule and complex single precision
   ///
-  /// @see ufcx_tabulate_tensor_single
+  /// @see ufcx_tabulate_tensor_float32
   typedef void(ufcx_tabulate_tensor_complex64)(
       float _Complex* restrict A, const float _Complex* restrict w,
       const float _Complex* restrict c, const float* restrict coordinate_dofs,
@@ -123,7 +123,7 @@ extern "C"
   /// Tabulate integral into tensor A with compiled
   /// quadrature rule and complex double precision
   ///
-  /// @see ufcx_tabulate_tensor_single
+  /// @see ufcx_tabulate_tensor_float32
   typedef void(ufcx_tabulate_tensor_complex128)(
       double _Complex* restrict A, const double _Complex* restrict w,
       const double _Complex* restrict c, const double* restrict coordinate_dofs,
@@ -131,6 +131,63 @@ extern "C"
       const uint8_t* restrict quadrature_permutation, void* custom_data);
 #endif // __STDC_NO_COMPLEX__
 
+  /// Tabulate integral for a batch of num_cells cells into tensor A
+  /// with compiled quadrature rule
+  ///
+  /// Data for cell i starts at A[i * A_stride], w[i * w_stride] and
+  /// coordinate_dofs[i * coordinate_dofs_stride], i.e. per-cell data is
+  /// stored contiguously, cell-major. Constants c are shared by all
+  /// cells in the batch. entity_local_index and quadrature_permutation
+  /// hold the per-cell entries consecutively (two entries per cell for
+  /// interior facet integrals, one otherwise); a null pointer can be
+  /// passed where the single-cell kernel accepts one.
+  ///
+  /// @see ufcx_tabulate_tensor_float32
+  typedef void(ufcx_tabulate_tensor_batch_float32)(
+      int num_cells, float* restrict A, const float* restrict w,
+      const float* restrict c, const float* restrict coordinate_dofs,
+      const int* restrict entity_local_index,
+      const uint8_t* restrict quadrature_permutation, void* custom_data,
+      int A_stride, int w_stride, int coordinate_dofs_stride);
+
+  /// Tabulate integral for a batch of cells with double precision
+  ///
+  /// @see ufcx_tabulate_tensor_batch_float32
+  typedef void(ufcx_tabulate_tensor_batch_float64)(
+      int num_cells, double* restrict A, const double* restrict w,
+      const double* restrict c, const double* restrict coordinate_dofs,
+      const int* restrict entity_local_index,
+      const uint8_t* restrict quadrature_permutation, void* custom_data,
+      int A_stride, int w_stride, int coordinate_dofs_stride);
+
+#ifndef __STDC_NO_COMPLEX__
+  /// Tabulate integral for a batch of cells with complex single
+  /// precision
+  ///
+  /// @see ufcx_tabulate_tensor_batch_float32
+  typedef void(ufcx_tabulate_tensor_batch_complex64)(
+      int num_cells, float _Complex* restrict A,
+      const float _Complex* restrict w, const float _Complex* restrict c,
+      const float* restrict coordinate_dofs,
+      const int* restrict entity_local_index,
+      const uint8_t* restrict quadrature_permutation, void* custom_data,
+      int A_stride, int w_stride, int coordinate_dofs_stride);
+#endif // __STDC_NO_COMPLEX__
+
+#ifndef __STDC_NO_COMPLEX__
+  /// Tabulate integral for a batch of cells with complex double
+  /// precision
+  ///
+  /// @see ufcx_tabulate_tensor_batch_float32
+  typedef void(ufcx_tabulate_tensor_batch_complex128)(
+      int num_cells, double _Complex* restrict A,
+      const double _Complex* restrict w, const double _Complex* restrict c,
+      const double* restrict coordinate_dofs,
+      const int* restrict entity_local_index,
+      const uint8_t* restrict quadrature_permutation, void* custom_data,
+      int A_stride, int w_stride, int coordinate_dofs_stride);
+#endif // __STDC_NO_COMPLEX__
+
   typedef struct ufcx_integral
   {
     const bool* enabled_coefficients;
@@ -139,9 +196,50 @@ extern "C"
 #ifndef __STDC_NO_COMPLEX__
     ufcx_tabulate_tensor_complex64* tabulate_tensor_complex64;
     ufcx_tabulate_tensor_complex128* tabulate_tensor_complex128;
+#endif // __STDC_NO_COMPLEX__
+    ufcx_tabulate_tensor_batch_float32* tabulate_tensor_batch_float32;
+    ufcx_tabulate_tensor_batch_float64* tabulate_tensor_batch_float64;
+#ifndef __STDC_NO_COMPLEX__
+    ufcx_tabulate_tensor_batch_complex64* tabulate_tensor_batch_complex64;
+    ufcx_tabulate_tensor_batch_complex128* tabulate_tensor_batch_complex128;
 #endif // __STDC_NO_COMPLEX__
     bool needs_facet_permutations;
 
+    /// Structural non-zero pattern of the element tensor, flattened
+    /// row-major over the tensor shape, or NULL if the tensor is dense
+    /// or the pattern was not computed. Entries that are false are
+    /// never written by the tabulate_tensor functions, so assemblers
+    /// may skip them during insertion.
+    const bool* nonzero_pattern;
+
+    /// True if the integral was compiled with part="symmetric": the
+    /// element tensor it tabulates satisfies A[i][j] == A[j][i], so
+    /// assemblers may insert only one triangle into a symmetric
+    /// operator.
+    bool symmetric;
+
+    /// Number of quadrature permutations per facet for which
+    /// specialized interior-facet kernels were generated, or 0 if
+    /// none.
+    int num_facet_permutations;
+
+    /// Interior-facet kernels specialized per quadrature permutation
+    /// pair, or NULL. Entry [p0 * num_facet_permutations + p1] has the
+    /// same signature as the active tabulate_tensor function and
+    /// assumes quadrature_permutation = {p0, p1}, so the permutation
+    /// arguments are ignored.
+    void** tabulate_tensor_permuted;
+
+    /// CUDA/HIP source of a batched device kernel equivalent to the
+    /// active tabulate_tensor function, or NULL. Intended for runtime
+    /// compilation with NVRTC/hipRTC; the kernel maps one cell to one
+    /// thread.
+    const char* tabulate_tensor_device_src;
+
+    /// Name of the __global__ kernel in tabulate_tensor_device_src,
+    /// or NULL.
+    const char* tabulate_tensor_device_name;
+
     /// Hash of the coordinate element associated with the geometry of the mesh.
     uint64_t coordinate_element_hash;
 
@@ -156,7 +254,7 @@ extern "C"
     /// @param[out] A Dimensions:
     /// `A[num_points][num_components][num_argument_dofs]`
     ///
-    /// @see ufcx_tabulate_tensor
+    /// @see ufcx_tabulate_tensor_float32
     ufcx_tabulate_tensor_float32* tabulate_tensor_float32;
     ufcx_tabulate_tensor_float64* tabulate_tensor_float64;
 #ifndef __STDC_NO_COMPLEX__
@@ -164,6 +262,17 @@ extern "C"
     ufcx_tabulate_tensor_complex128* tabulate_tensor_complex128;
 #endif // __STDC_NO_COMPLEX__
 
+    /// Evaluate expression for a batch of cells, with per-cell strides
+    /// for the output, the coefficients and the coordinate dofs.
+    ///
+    /// @see ufcx_tabulate_tensor_batch_float32
+    ufcx_tabulate_tensor_batch_float32* tabulate_tensor_batch_float32;
+    ufcx_tabulate_tensor_batch_float64* tabulate_tensor_batch_float64;
+#ifndef __STDC_NO_COMPLEX__
+    ufcx_tabulate_tensor_batch_complex64* tabulate_tensor_batch_complex64;
+    ufcx_tabulate_tensor_batch_complex128* tabulate_tensor_batch_complex128;
+#endif // __STDC_NO_COMPLEX__
+
     /// Number of coefficients
     int num_coefficients;
 
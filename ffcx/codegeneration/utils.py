@@ -59,6 +59,21 @@ def dtype_to_scalar_dtype(dtype: npt.DTypeLike | str) -> np.dtype:
         raise RuntimeError(f"Cannot get value dtype for '{dtype}'. ")
 
 
+def c_string_escape(text: str) -> str:
+    """Escape text for inclusion in a C string literal.
+
+    Args:
+        text: Text to escape.
+
+    Returns:
+        ``text`` with backslashes, quotes and line breaks escaped, safe
+        to place between double quotes in generated C code.
+    """
+    return (
+        text.replace("\\", "\\\\").replace('"', '\\"').replace("\n", "\\n").replace("\r", "\\r")
+    )
+
+
 def numba_ufcx_kernel_signature(dtype: npt.DTypeLike, xdtype: npt.DTypeLike):
     """Return a Numba C signature for the UFCx ``tabulate_tensor`` interface.
 
@@ -66,15 +66,22 @@ Compiler stages
 from __future__ import annotations
 
 import logging
+import os
+import pickle
+import tempfile
 import typing
+from pathlib import Path
 from time import time
 
+import numpy as np
 import numpy.typing as npt
 
+from ffcx import profiling
 from ffcx.analysis import analyze_ufl_objects
-from ffcx.codegeneration.codegeneration import generate_code
-from ffcx.formatting import format_code
+from ffcx.codegeneration.codegeneration import generate_code, stream_code
+from ffcx.formatting import format_code, format_code_split
 from ffcx.ir.representation import compute_ir
+from ffcx.naming import compute_signature
 
 logger = logging.getLogger("ffcx")
 
@@ -83,13 +90,48 @@ def _print_timing(stage: int, timing: float) -> None:
     logger.info(f"Compiler stage {stage} finished in {timing:.4f} seconds.")
 
 
+def _load_cached_stage(filename: Path) -> typing.Any:
+    """Load a pickled compiler stage result, or None if unavailable."""
+    try:
+        with open(filename, "rb") as f:
+            return pickle.load(f)
+    except FileNotFoundError:
+        # Normal cache miss
+        return None
+    except Exception as e:
+        logger.warning(
+            f"Failed to load cached compiler stage from {filename}, recomputing: {e!r}"
+        )
+        return None
+
+
+def _store_cached_stage(filename: Path, obj: typing.Any) -> None:
+    """Pickle a compiler stage result to disk, atomically and best-effort."""
+    try:
+        filename.parent.mkdir(exist_ok=True, parents=True)
+        fd, tmp_name = tempfile.mkstemp(dir=filename.parent, suffix=".tmp")
+        try:
+            with os.fdopen(fd, "wb") as f:
+                pickle.dump(obj, f)
+            os.replace(tmp_name, filename)
+        except Exception:
+            os.unlink(tmp_name)
+            raise
+    except Exception as e:
+        logger.warning(f"Failed to cache compiler stage to {filename}: {e!r}")
+
+
 def compile_ufl_objects(
     ufl_objects: list[typing.Any],
     options: dict[str, int | float | npt.DTypeLike],
     object_names: dict[int, str] | None = None,
     prefix: str | None = None,
     visualise: bool = False,
-) -> tuple[str, str]:
+    split_integrals: bool = False,
+    ir_cache_dir: Path | str | None = None,
+    benchmark: bool = False,
+    codegen_workers: int = 1,
+) -> tuple[str, str] | tuple[str, list[str]] | tuple[str, str, str]:
     """Generate UFC code for a given UFL objects.
 
     Args:
@@ -99,6 +141,116 @@ def compile_ufl_objects(
         prefix: Prefix
         options: Options
         visualise: Toggle visualisation
+        split_integrals: Place each integral in a separate translation
+          unit. The source code is then returned as a list of strings
+          that can be compiled separately and linked together.
+        benchmark: When True, additionally return the source of a
+          standalone C driver that times each generated integral kernel
+          on synthetic inputs.
+        ir_cache_dir: Directory for an on-disk cache of stages 1-2,
+          keyed by the UFL signature. The analysis stage only depends on
+          whether the scalar type is complex, so its cache entry is
+          shared across scalar precisions. Cache entries that cannot be
+          loaded are silently recomputed.
+        codegen_workers: Number of worker processes used in the code
+          generation stage. Values > 1 generate the independent
+          integral, form and expression IRs concurrently with
+          deterministic output ordering; element tables are then
+          declared in-kernel instead of pooled at file scope.
+    """
+    _object_names = object_names if object_names is not None else {}
+    _prefix = prefix if prefix is not None else ""
+
+    profile_file = options.get("profile_file")
+    if profile_file:
+        profiling.enable()
+
+    # Look for a cached intermediate representation. The generated names
+    # depend on the prefix and the options, so both are part of the key.
+    ir = None
+    ir_cache_file = None
+    if ir_cache_dir is not None:
+        tag = "ir;" + _prefix + ";" + str(sorted(options.items()))
+        key = compute_signature(ufl_objects, tag)
+        ir_cache_file = Path(ir_cache_dir).joinpath(f"ffcx_ir_{key}.pickle")
+        ir = _load_cached_stage(ir_cache_file)
+        if ir is not None:
+            logger.info(f"Reusing cached intermediate representation from {ir_cache_file}")
+
+    if ir is None:
+        # Stage 1: analysis
+        analysis = None
+        analysis_cache_file = None
+        if ir_cache_dir is not None:
+            is_complex = np.issubdtype(np.dtype(options["scalar_type"]), np.complexfloating)  # type: ignore
+            tag = "analysis;" + ("complex" if is_complex else "real")
+            key = compute_signature(ufl_objects, tag)
+            analysis_cache_file = Path(ir_cache_dir).joinpath(f"ffcx_analysis_{key}.pickle")
+            analysis = _load_cached_stage(analysis_cache_file)
+            if analysis is not None:
+                logger.info(f"Reusing cached analysis from {analysis_cache_file}")
+
+        if analysis is None:
+            cpu_time = time()
+            analysis = analyze_ufl_objects(ufl_objects, options["scalar_type"])  # type: ignore
+            stage_time = time() - cpu_time
+            _print_timing(1, stage_time)
+            profiling.record_stage("analysis", stage_time)
+            if analysis_cache_file is not None:
+                _store_cached_stage(analysis_cache_file, analysis)
+
+        # Stage 2: intermediate representation
+        cpu_time = time()
+        ir = compute_ir(analysis, _object_names, _prefix, options, visualise)
+        stage_time = time() - cpu_time
+        _print_timing(2, stage_time)
+        profiling.record_stage("compute_ir", stage_time)
+        if ir_cache_file is not None:
+            _store_cached_stage(ir_cache_file, ir)
+
+    # Stage 3: code generation
+    cpu_time = time()
+    code = generate_code(ir, options, workers=codegen_workers)
+    stage_time = time() - cpu_time
+    _print_timing(3, stage_time)
+    profiling.record_stage("generate_code", stage_time)
+
+    # Stage 4: format code
+    cpu_time = time()
+    if split_integrals:
+        code_h, code_c = format_code_split(code)
+    else:
+        code_h, code_c = format_code(code)
+    stage_time = time() - cpu_time
+    _print_timing(4, stage_time)
+    profiling.record_stage("format_code", stage_time)
+
+    if profile_file:
+        profiling.write(profile_file)
+
+    if benchmark:
+        from ffcx.codegeneration.C.benchmark import generate_benchmark
+
+        return code_h, code_c, generate_benchmark(ir, options, _prefix)
+
+    return code_h, code_c
+
+
+def compile_ufl_objects_to_files(
+    ufl_objects: list[typing.Any],
+    options: dict[str, int | float | npt.DTypeLike],
+    object_names: dict[int, str] | None = None,
+    prefix: str | None = None,
+    output_dir: str = ".",
+    visualise: bool = False,
+) -> None:
+    """Generate UFC code for UFL objects, streaming the output to files.
+
+    Writes <prefix>.h and <prefix>.c in output_dir with the same
+    content as compile_ufl_objects followed by write_code, but streams
+    each generated block straight to disk, so peak memory is bounded by
+    the largest single kernel. Intended for very large compilation
+    units where holding the whole source in memory is the limit.
     """
     _object_names = object_names if object_names is not None else {}
     _prefix = prefix if prefix is not None else ""
@@ -113,14 +265,10 @@ def compile_ufl_objects(
     ir = compute_ir(analysis, _object_names, _prefix, options, visualise)
     _print_timing(2, time() - cpu_time)
 
-    # Stage 3: code generation
+    # Stages 3-4: generate, format and write code in one streaming pass
     cpu_time = time()
-    code = generate_code(ir, options)
+    h_path = Path(output_dir).joinpath(_prefix + ".h")
+    c_path = Path(output_dir).joinpath(_prefix + ".c")
+    with open(h_path, "w") as h_out, open(c_path, "w") as c_out:
+        stream_code(ir, options, h_out, c_out)
     _print_timing(3, time() - cpu_time)
-
-    # Stage 4: format code
-    cpu_time = time()
-    code_h, code_c = format_code(code)
-    _print_timing(4, time() - cpu_time)
-
-    return code_h, code_c
@@ -38,6 +38,40 @@ def format_code(code: CodeBlocks) -> tuple[str, str]:
     return code_h, code_c
 
 
+def format_code_split(code: CodeBlocks) -> tuple[str, list[str]]:
+    """Format given code with each integral in a separate translation unit.
+
+    Returns the header file contents and a list of source file contents.
+    The first source contains the file preamble, the forms and the
+    expressions, together with extern declarations of the integrals; each
+    remaining source contains a single integral. The sources can be
+    compiled separately and linked into one module.
+    """
+    logger.info(79 * "*")
+    logger.info("Compiler stage 5: Formatting code (split translation units)")
+    logger.info(79 * "*")
+
+    code_h = ""
+    for parts_code in code:
+        code_h += "".join([c[0] for c in parts_code])
+
+    preamble = "".join(c[1] for c in code.file_pre)
+    postamble = "".join(c[1] for c in code.file_post)
+
+    main_c = (
+        preamble
+        + "".join(c[0] for c in code.integrals)
+        + "".join(c[1] for c in code.forms)
+        + "".join(c[1] for c in code.expressions)
+        + postamble
+    )
+    sources = [main_c]
+    for c in code.integrals:
+        sources.append(preamble + c[1] + postamble)
+
+    return code_h, sources
+
+
 def write_code(code_h: str, code_c: str, prefix: str, output_dir: str) -> None:
     """Write code to files."""
     _write_file(code_h, prefix, ".h", output_dir)
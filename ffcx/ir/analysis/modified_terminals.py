@@ -6,6 +6,7 @@
 """Modified terminals."""
 
 import logging
+from functools import lru_cache
 
 from ufl.classes import (
     Argument,
@@ -167,6 +168,7 @@ def strip_modified_terminal(v):
     return v
 
 
+@lru_cache(maxsize=100000)
 def analyse_modified_terminal(expr):
     """Analyse a so-called 'modified terminal' expression.
 
@@ -178,6 +180,9 @@ def analyse_modified_terminal(expr):
     The wrapper types can include 0-* Grad or ReferenceGrad objects,
     and 0-1 ReferenceValue, 0-1 Restricted, 0-1 Indexed,
     and 0-1 FacetAvg or CellAvg objects.
+
+    The analysis is pure and the same modified terminals are visited
+    from several compiler stages, so results are interned.
     """
     # Data to determine
     component = None
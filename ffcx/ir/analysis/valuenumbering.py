@@ -63,30 +63,31 @@ class ValueNumberer:
 
     def get_node_symbols(self, expr):
         """Get node symbols."""
-        idx = [i for i, v in self.G.nodes.items() if v["expression"] == expr][0]
-        return self.V_symbols[idx]
+        return self.V_symbols[self.G.e2i[expr]]
 
     def compute_symbols(self):
         """Compute symbols."""
+        # Resolved handler per expression type; avoids re-walking the
+        # lookup table for every node of a common type
+        resolved = {}
         for i, v in self.G.nodes.items():
             expr = v["expression"]
-            symbol = None
-            # First look for exact type match
-            f = self.call_lookup.get(type(expr), False)
-            if f:
-                symbol = f(expr)
-            else:
-                # Look for parent class types instead
-                for k in self.call_lookup.keys():
-                    if isinstance(expr, k):
-                        symbol = self.call_lookup[k](expr)
-                        break
-
-            if symbol is None:
-                # Nothing found
-                raise RuntimeError(f"Not expecting type {type(expr)} here.")
-
-            self.V_symbols.append(symbol)
+            f = resolved.get(type(expr))
+            if f is None:
+                # First look for exact type match, then for parent
+                # class types
+                f = self.call_lookup.get(type(expr))
+                if f is None:
+                    for k, handler in self.call_lookup.items():
+                        if isinstance(expr, k):
+                            f = handler
+                            break
+                if f is None:
+                    # Nothing found
+                    raise RuntimeError(f"Not expecting type {type(expr)} here.")
+                resolved[type(expr)] = f
+
+            self.V_symbols.append(f(expr))
 
         return self.V_symbols
 
@@ -161,7 +162,7 @@ class ValueNumberer:
             tdim = domain.topological_dimension
             d_components = ufl.permutation.compute_indices((tdim,) * num_ld)
         elif num_gd:
-            domain = ufl.domain.extract_unique_domiain(mt.terminal)
+            domain = ufl.domain.extract_unique_domain(mt.terminal)
             gdim = domain.geometric_dimension
             d_components = ufl.permutation.compute_indices((gdim,) * num_gd)
         else:
@@ -558,17 +558,32 @@ def build_optimized_tables(
         cell_offset = 0
 
         if use_sum_factorization and (not quadrature_rule.has_tensor_factors):
-            raise RuntimeError("Sum factorization not available for this quadrature rule.")
+            # Quadrature rules without a tensor product structure (facet
+            # and ridge integrals, simplices) cannot be factorized; fall
+            # back to the unfactorized tables for this integral
+            logger.debug(
+                "Sum factorization not available for this quadrature rule, "
+                "using unfactorized tables."
+            )
+
+        # Blocked (e.g. vector-valued) elements tabulate through their
+        # scalar sub-element, so the sub-element factorisation applies to
+        # every block component
+        tp_element = element
+        if not getattr(tp_element, "has_tensor_product_factorisation", False):
+            sub_element = getattr(element, "_sub_element", None)
+            if sub_element is not None:
+                tp_element = sub_element
 
         tensor_factors: list[UniqueTableReferenceT] | None = None
         tensor_perm = None
         if (
             use_sum_factorization
-            and element.has_tensor_product_factorisation
-            and len(element.get_tensor_product_representation()) == 1
+            and getattr(tp_element, "has_tensor_product_factorisation", False)
+            and len(tp_element.get_tensor_product_representation()) == 1
             and quadrature_rule.has_tensor_factors
         ):
-            factors = element.get_tensor_product_representation()
+            factors = tp_element.get_tensor_product_representation()
 
             tensor_factors = []
             for i, j in enumerate(factors[0]):
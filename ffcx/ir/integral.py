@@ -38,6 +38,7 @@ class TensorPart(Enum):
     """What part of the tensor to assemble."""
 
     full = 1
+    symmetric = 2
     diagonal = 4
 
     @classmethod
@@ -45,6 +46,8 @@ class TensorPart(Enum):
         """Workaround for string enum prior to Python 3.11."""
         if value == "full":
             return cls.full
+        elif value == "symmetric":
+            return cls.symmetric
         elif value == "diagonal":
             return cls.diagonal
         else:
@@ -54,6 +57,8 @@ class TensorPart(Enum):
         """Get string value."""
         if self == TensorPart.full:
             return "full"
+        elif self == TensorPart.symmetric:
+            return "symmetric"
         elif self == TensorPart.diagonal:
             return "diagonal"
         else:
@@ -22,6 +22,7 @@ import itertools
 import logging
 import typing
 import warnings
+from time import time
 
 import basix
 import numpy as np
@@ -30,7 +31,7 @@ import ufl
 from ufl.classes import Integral
 from ufl.sorting import sorted_expr_sum
 
-from ffcx import naming
+from ffcx import naming, profiling
 from ffcx.analysis import UFLData
 from ffcx.ir.integral import CommonExpressionIR, TensorPart, compute_integral_ir
 from ffcx.ir.representationutils import QuadratureRule, create_quadrature_points_and_weights
@@ -220,6 +221,7 @@ def _compute_integral_ir(
     irs = []
     for itg_data_index, itg_data in enumerate(form_data.integral_data):
         logger.info(f"Computing IR for integral in integral group {itg_data_index}")
+        itg_cpu_time = time()
         expression_ir = {}
 
         # Compute representation
@@ -247,6 +249,10 @@ def _compute_integral_ir(
             assert form_data.argument_elements[0] == form_data.argument_elements[1], (
                 "Can only diagonalise forms with identical arguments."
             )
+        if form_data.rank == 2 and ir["part"] == TensorPart.symmetric:
+            assert form_data.argument_elements[0] == form_data.argument_elements[1], (
+                "Symmetric assembly requires forms with identical arguments."
+            )
 
         # Get element space dimensions
         unique_elements = element_numbers.keys()
@@ -415,6 +421,9 @@ def _compute_integral_ir(
         expression_ir["name"] = integral_names[(form_index, itg_data_index)]
         ir["expression"] = CommonExpressionIR(**expression_ir)
         irs.append(IntegralIR(**ir))
+        profiling.record_integral_metric(
+            expression_ir["name"], "compute_ir_time", time() - itg_cpu_time
+        )
 
     return irs
 
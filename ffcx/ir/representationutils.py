@@ -63,7 +63,7 @@ def create_quadrature_points_and_weights(
     tensor_factors = {}
     if integral_type == "cell":
         cell_name = cell.cellname
-        if cell_name in ["quadrilateral", "hexahedron"] and use_tensor_product:
+        if cell_name in ["quadrilateral", "hexahedron", "prism"] and use_tensor_product:
             if cell_name == "quadrilateral":
                 tensor_factors[cell_name] = [
                     create_quadrature("interval", degree, rule, elements) for _ in range(2)
@@ -72,9 +72,14 @@ def create_quadrature_points_and_weights(
                 tensor_factors[cell_name] = [
                     create_quadrature("interval", degree, rule, elements) for _ in range(3)
                 ]
+            elif cell_name == "prism":
+                tensor_factors[cell_name] = [
+                    create_quadrature("triangle", degree, rule, elements),
+                    create_quadrature("interval", degree, rule, elements),
+                ]
             pts[cell_name] = np.array(
                 [
-                    tuple(i[0] for i in p)
+                    tuple(c for i in p for c in i)
                     for p in itertools.product(*[f[0] for f in tensor_factors[cell_name]])
                 ]
             )
@@ -31,6 +31,22 @@ parser.add_argument("--version", action="version", version=f"%(prog)s (version {
 parser.add_argument("-o", "--output-directory", type=str, default=".", help="output directory")
 parser.add_argument("--visualise", action="store_true", help="visualise the IR graph")
 parser.add_argument("-p", "--profile", action="store_true", help="enable profiling")
+parser.add_argument(
+    "--benchmark",
+    action="store_true",
+    help="emit a standalone C driver that times each generated kernel on synthetic inputs",
+)
+parser.add_argument(
+    "--stream",
+    action="store_true",
+    help="stream generated code to disk block by block to reduce peak memory on large forms",
+)
+parser.add_argument(
+    "--codegen-workers",
+    type=int,
+    default=1,
+    help="number of worker processes for the code generation stage (default=1)",
+)
 
 # Add all options from FFCx option system
 for opt_name, (arg_type, opt_val, opt_desc, choices) in FFCX_DEFAULT_OPTIONS.items():
@@ -56,6 +72,12 @@ def main(args: Sequence[str] | None = None) -> int:
     priority_options = {k: v for k, v in xargs.__dict__.items() if v is not None}
     options = get_options(priority_options)
 
+    if xargs.stream and xargs.benchmark:
+        logger.warning(
+            "--stream is ignored with --benchmark: the benchmark driver "
+            "needs the generated code in memory"
+        )
+
     # Call parser and compiler for each file
     for filename in xargs.ufl_file:
         file = pathlib.Path(filename)
@@ -75,15 +97,37 @@ def main(args: Sequence[str] | None = None) -> int:
         ufd = ufl.algorithms.load_ufl_file(filename)
 
         # Generate code
-        code_h, code_c = compiler.compile_ufl_objects(
+        if xargs.stream and not xargs.benchmark:
+            compiler.compile_ufl_objects_to_files(
+                ufd.forms + ufd.expressions + ufd.elements,
+                options=options,
+                object_names=ufd.object_names,
+                prefix=prefix,
+                output_dir=xargs.output_directory,
+                visualise=xargs.visualise,
+            )
+            if xargs.profile:
+                pr.disable()
+                pr.dump_stats(f"ffcx_{prefix}.profile")
+            continue
+
+        code = compiler.compile_ufl_objects(
             ufd.forms + ufd.expressions + ufd.elements,
             options=options,
             object_names=ufd.object_names,
             prefix=prefix,
             visualise=xargs.visualise,
+            benchmark=xargs.benchmark,
+            codegen_workers=xargs.codegen_workers,
         )
 
         # Write to file
+        if xargs.benchmark:
+            code_h, code_c, code_bench = code
+            bench_file = pathlib.Path(xargs.output_directory) / f"{prefix}_benchmark.c"
+            bench_file.write_text(code_bench)
+        else:
+            code_h, code_c = code
         formatting.write_code(code_h, code_c, prefix, xargs.output_directory)
 
         # Turn off profiling and write status to file
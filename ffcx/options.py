@@ -28,6 +28,39 @@ FFCX_DEFAULT_OPTIONS = {
         ("float32", "float64", "complex64", "complex128"),
     ),
     "sum_factorization": (bool, False, "use sum factorization.", None),
+    "vector_width": (
+        int,
+        1,
+        "SIMD vector width to target in generated kernels; values > 1 annotate the "
+        "innermost loops with '#pragma omp simd' for the given lane count. The JIT "
+        "adds -fopenmp-simd automatically; ahead-of-time builds must pass it (or "
+        "-fopenmp) themselves or the pragmas are ignored.",
+        None,
+    ),
+    "table_alignment": (
+        int,
+        0,
+        "byte alignment for static element tables; values > 0 pad the trailing (dof) "
+        "dimension to a multiple of the alignment and declare tables with _Alignas, so "
+        "every table row starts on an aligned boundary.",
+        None,
+    ),
+    "unroll_threshold": (
+        int,
+        0,
+        "fully unroll quadrature loops with at most this many points and jam the "
+        "argument-dof loops of the unrolled iterations; 0 disables unrolling.",
+        None,
+    ),
+    "table_sidecar": (
+        str,
+        "",
+        "path of a binary sidecar file to hold the element tables; the generated module "
+        "memory-maps it on first use instead of carrying the tables as C initializer "
+        "lists, cutting compile time and resident memory for large high-order tables. "
+        "POSIX only; empty keeps tables in the C source.",
+        None,
+    ),
     "table_rtol": (
         float,
         1e-6,
@@ -46,7 +79,41 @@ FFCX_DEFAULT_OPTIONS = {
         "logger verbosity, follows standard library levels, i.e. INFO=20, DEBUG=10, etc.",
         None,
     ),
-    "part": (str, "full", "Part of bilinear tensor to assemble", ("full", "diagonal")),
+    "part": (
+        str,
+        "full",
+        "Part of bilinear tensor to assemble. 'symmetric' computes only the upper "
+        "triangle and mirrors it into the lower, for forms with A = A^T.",
+        ("full", "symmetric", "diagonal"),
+    ),
+    "device_backend": (
+        str,
+        "none",
+        "emit CUDA/HIP device kernels next to the C kernels, embedded in ufcx_integral "
+        "as source for runtime compilation with NVRTC/hipRTC.",
+        ("none", "cuda", "hip"),
+    ),
+    "packed_coefficients": (
+        bool,
+        False,
+        "gather block-strided coefficient dofs into contiguous scratch arrays at kernel "
+        "entry, so the dof-contraction loops see unit-stride loads from w.",
+        None,
+    ),
+    "specialize_facet_permutations": (
+        bool,
+        False,
+        "generate one interior-facet kernel per quadrature permutation pair, with "
+        "compile-time table offsets, exposed via ufcx_integral::tabulate_tensor_permuted.",
+        None,
+    ),
+    "profile_file": (
+        str,
+        "",
+        "path to write a JSON compilation profile with per-stage and per-integral "
+        "timings and static kernel metrics; empty disables profiling.",
+        None,
+    ),
 }
 
 
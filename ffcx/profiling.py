@@ -0,0 +1,73 @@
+# Copyright (C) 2026 The FEniCS Project
+#
+# This file is part of FFCx. (https://www.fenicsproject.org)
+#
+# SPDX-License-Identifier:    LGPL-3.0-or-later
+"""Structured profiling of FFCx compilation.
+
+Collects wall-clock timings per compiler stage and per integral,
+together with static kernel metrics, and writes them out as JSON.
+Profiling is enabled through the ``profile_file`` option; the collector
+is process-global, matching the one-compilation-at-a-time use of the
+compiler entry points.
+"""
+
+from __future__ import annotations
+
+import json
+import logging
+import time
+import typing
+from contextlib import contextmanager
+from pathlib import Path
+
+logger = logging.getLogger("ffcx")
+
+_profile: dict | None = None
+
+
+def enable() -> None:
+    """Start collecting a fresh profile, discarding any previous one."""
+    global _profile
+    _profile = {"stages": {}, "integrals": {}}
+
+
+def is_enabled() -> bool:
+    """Return True if a profile is being collected."""
+    return _profile is not None
+
+
+def record_stage(stage: str, seconds: float) -> None:
+    """Record (accumulate) wall-clock time spent in a compiler stage."""
+    if _profile is not None:
+        stages = _profile["stages"]
+        stages[stage] = stages.get(stage, 0.0) + seconds
+
+
+def record_integral_metric(name: str, key: str, value: typing.Any) -> None:
+    """Record a static metric (e.g. operation count) for an integral."""
+    if _profile is not None:
+        _profile["integrals"].setdefault(name, {})[key] = value
+
+
+@contextmanager
+def time_integral(name: str, key: str):
+    """Time a block of work attributed to one integral."""
+    if _profile is None:
+        yield
+        return
+    t0 = time.time()
+    try:
+        yield
+    finally:
+        record_integral_metric(name, key, time.time() - t0)
+
+
+def write(filename: Path | str) -> None:
+    """Write the collected profile as JSON; keeps collecting afterwards."""
+    if _profile is None:
+        return
+    try:
+        Path(filename).write_text(json.dumps(_profile, indent=2, sort_keys=True))
+    except OSError:
+        logger.warning(f"Failed to write compilation profile to {filename}.")
@@ -0,0 +1,105 @@
+# Copyright (C) 2026 The FEniCS Project
+#
+# This file is part of FFCx. (https://www.fenicsproject.org)
+#
+# SPDX-License-Identifier:    LGPL-3.0-or-later
+"""Kernel variants specialized on enabled coefficients.
+
+ufcx_integral.enabled_coefficients is a runtime flag array: the kernel
+body still gathers and evaluates every coefficient wired into the form.
+For multi-material setups where a coefficient is identically zero on
+most subdomains, this module builds form variants with the chosen
+coefficients replaced by zero, so the whole compiler pipeline
+(factorization, table building, code generation) removes the dead
+coefficient code, and compiles all variants into one module. The
+assembler can then pick the stripped kernel per subdomain and use
+ufcx_form.original_coefficient_positions to map the remaining
+coefficients back to the originals.
+
+bake_constants plays the same role for Constants: values fixed at setup
+(material parameters, the timestep of a fixed-dt run) are folded into
+the generated code as literals instead of being read from the runtime
+c array on every tabulate_tensor call.
+"""
+
+from __future__ import annotations
+
+import typing
+
+import numpy as np
+import ufl
+
+import ffcx.codegeneration.jit
+
+
+def strip_coefficients(
+    form: ufl.Form, zero_coefficients: typing.Iterable[ufl.Coefficient]
+) -> ufl.Form:
+    """Return form with the given coefficients replaced by zero.
+
+    The replacement happens at the UFL level, so terms multiplied by a
+    stripped coefficient vanish before analysis and no gather or
+    evaluation code is generated for them.
+    """
+    replace_map: dict[ufl.Coefficient, ufl.classes.Zero] = {
+        coefficient: ufl.classes.Zero(coefficient.ufl_shape)
+        for coefficient in zero_coefficients
+    }
+    return ufl.replace(form, replace_map)
+
+
+def bake_constants(
+    form: ufl.Form, constant_values: typing.Mapping[ufl.Constant, typing.Any]
+) -> ufl.Form:
+    """Return form with the given constants replaced by literal values.
+
+    Args:
+        form: Form to specialize.
+        constant_values: Map from a Constant in the form to its fixed
+          value: a scalar, or a nested sequence/array matching the
+          constant's shape.
+
+    The replacement happens at the UFL level, so the fixed values reach
+    code generation as literals and participate in constant folding and
+    factorization; the baked constants drop out of the form's constant
+    metadata and are no longer read from the runtime c array.
+    """
+    replace_map: dict[ufl.Constant, ufl.core.expr.Expr] = {}
+    for constant, value in constant_values.items():
+        if constant.ufl_shape:
+            values = np.asarray(value)
+            if values.shape != constant.ufl_shape:
+                raise ValueError(
+                    f"Value of shape {values.shape} given for constant "
+                    f"of shape {constant.ufl_shape}."
+                )
+            replace_map[constant] = ufl.as_tensor(values.tolist())
+        else:
+            replace_map[constant] = ufl.constantvalue.as_ufl(value)
+    return ufl.replace(form, replace_map)
+
+
+def compile_coefficient_variants(
+    form: ufl.Form,
+    zero_sets: typing.Sequence[typing.Iterable[ufl.Coefficient]],
+    options: dict[str, typing.Any] | None = None,
+    **kwargs,
+):
+    """Compile kernel variants of form with coefficient subsets zeroed.
+
+    Args:
+        form: Form to specialize.
+        zero_sets: One entry per requested variant: the coefficients to
+          treat as identically zero in that variant. An empty set gives
+          the unstripped form.
+        options: FFCx options passed through to compilation.
+        kwargs: Passed through to compile_forms (e.g. cache_dir,
+          cffi_extra_compile_args).
+
+    Returns:
+        (compiled_variants, module, code) as returned by compile_forms,
+        with one compiled form per entry in zero_sets, all sharing one
+        module.
+    """
+    variants = [strip_coefficients(form, zero_set) for zero_set in zero_sets]
+    return ffcx.codegeneration.jit.compile_forms(variants, options=options, **kwargs)
@@ -0,0 +1,205 @@
+# Copyright (C) 2026 The FEniCS Project
+#
+# This file is part of FFCx. (https://www.fenicsproject.org)
+#
+# SPDX-License-Identifier:    LGPL-3.0-or-later
+"""Quadrature degree auto-tuning.
+
+UFL's quadrature degree estimate is exact for polynomial integrands on
+affine cells but often several degrees too conservative for curved
+geometry or non-polynomial coefficients. This module compiles kernel
+variants of a form at a range of quadrature degrees, evaluates them on
+a deterministic perturbed reference cell, and returns the lowest degree
+whose element tensor matches a high-degree reference to a user-supplied
+tolerance. Choices are recorded in a JSON cache keyed by the form
+signature, so the search cost is paid once per form.
+
+Only cell integrals are evaluated; the chosen degree is applied to the
+whole form. Apply the result with quadrature metadata, e.g.
+``ufl.dx(degree=tuned_degree)``, or via :func:`set_quadrature_degree`.
+"""
+
+from __future__ import annotations
+
+import json
+import logging
+import typing
+
+import basix
+import numpy as np
+import ufl
+
+import ffcx.codegeneration.jit
+from ffcx.codegeneration.utils import dtype_to_c_type, dtype_to_scalar_dtype
+from ffcx.naming import compute_signature
+
+logger = logging.getLogger("ffcx")
+
+
+def set_quadrature_degree(form: ufl.Form, degree: int) -> ufl.Form:
+    """Return form with the quadrature degree fixed on every integral."""
+    integrals = [
+        integral.reconstruct(
+            metadata={**(integral.metadata() or {}), "quadrature_degree": degree}
+        )
+        for integral in form.integrals()
+    ]
+    return ufl.Form(integrals)
+
+
+def _coordinate_dofs(domain: ufl.Mesh) -> np.ndarray:
+    """Build coordinate dofs for a deterministic perturbed reference cell.
+
+    The perturbation makes the geometry a generic (curved, for higher
+    order coordinate elements) map, so superfluous quadrature points
+    actually change the computed tensor.
+    """
+    coordinate_element = domain.ufl_coordinate_element()
+    scalar_element = getattr(coordinate_element, "_sub_element", coordinate_element)
+
+    points = getattr(getattr(scalar_element, "_element", None), "points", None)
+    if points is None:
+        cell = getattr(basix.CellType, domain.ufl_cell().cellname())
+        points = basix.cell.geometry(cell)
+    points = np.asarray(points, dtype=np.float64)
+
+    tdim = points.shape[1]
+    rng = np.random.default_rng(13)
+    x = np.zeros((points.shape[0], 3))
+    x[:, :tdim] = points + 0.05 * (rng.random(points.shape) - 0.5)
+    return x
+
+
+def _evaluate_cell_tensor(
+    form: ufl.Form,
+    options: dict[str, typing.Any],
+    cffi_extra_compile_args: list[str] | None,
+) -> np.ndarray:
+    """Compile form and evaluate its cell integrals on one cell."""
+    compiled_forms, module, _ = ffcx.codegeneration.jit.compile_forms(
+        [form], options=options, cffi_extra_compile_args=cffi_extra_compile_args
+    )
+    compiled_form = compiled_forms[0]
+    ffi = module.ffi
+
+    dtype = np.dtype(options.get("scalar_type", "float64"))
+    xdtype = dtype_to_scalar_dtype(dtype)
+    c_type = dtype_to_c_type(dtype)
+    c_xtype = dtype_to_c_type(xdtype)
+
+    shape = tuple(
+        arg.ufl_function_space().ufl_element().dim for arg in form.arguments()
+    ) or (1,)
+    A = np.zeros(shape, dtype=dtype)
+
+    # Deterministic coefficient/constant data in [1, 2), packed in the
+    # order the kernels expect
+    rng = np.random.default_rng(17)
+    w_size = sum(coeff.ufl_function_space().ufl_element().dim for coeff in form.coefficients())
+    w = (1.0 + rng.random(max(w_size, 1))).astype(dtype)
+    c_size = sum(int(np.prod(constant.ufl_shape, initial=1)) for constant in form.constants())
+    c = (1.0 + rng.random(max(c_size, 1))).astype(dtype)
+
+    (domain,) = form.ufl_domains()
+    # The kernels take the coordinate dofs in the real type matching the
+    # scalar type, e.g. float for float32 kernels
+    coords = _coordinate_dofs(domain).astype(xdtype)
+
+    offsets = compiled_form.form_integral_offsets
+    cell = module.lib.cell
+    for i in range(offsets[cell], offsets[cell + 1]):
+        integral = compiled_form.form_integrals[i]
+        kernel = getattr(integral, f"tabulate_tensor_{dtype.name}")
+        kernel(
+            ffi.cast(f"{c_type} *", A.ctypes.data),
+            ffi.cast(f"{c_type} *", w.ctypes.data),
+            ffi.cast(f"{c_type} *", c.ctypes.data),
+            ffi.cast(f"{c_xtype} *", coords.ctypes.data),
+            ffi.NULL,
+            ffi.NULL,
+            ffi.NULL,
+        )
+    return A
+
+
+def _load_cache(cache_file) -> dict[str, int]:
+    try:
+        with open(cache_file) as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return {}
+
+
+def _store_cache(cache_file, cache: dict[str, int]) -> None:
+    try:
+        with open(cache_file, "w") as f:
+            json.dump(cache, f, indent=2, sort_keys=True)
+    except OSError:
+        logger.warning(f"Failed to write quadrature tuning cache to {cache_file}.")
+
+
+def tune_quadrature_degree(
+    form: ufl.Form,
+    tolerance: float = 1e-10,
+    degrees: typing.Iterable[int] = range(1, 9),
+    options: dict[str, typing.Any] | None = None,
+    cache_file=None,
+    cffi_extra_compile_args: list[str] | None = None,
+) -> int:
+    """Find the lowest quadrature degree meeting a tolerance for a form.
+
+    Compiles the form at each candidate degree and compares the element
+    tensor of its cell integrals, evaluated on a perturbed reference
+    cell with deterministic data, against a reference computed two
+    degrees above the largest candidate.
+
+    Args:
+        form: Form to tune. Must have at least one cell integral.
+        tolerance: Maximum acceptable relative error (Frobenius norm)
+          against the reference tensor.
+        degrees: Candidate quadrature degrees, tried in ascending order.
+        options: FFCx options passed through to compilation.
+        cache_file: Optional path of a JSON file mapping form signature
+          to the chosen degree; hits skip the search entirely.
+        cffi_extra_compile_args: Extra C compiler arguments.
+
+    Returns:
+        The lowest candidate degree meeting the tolerance, or the
+        largest candidate if none does.
+    """
+    options = dict(options) if options is not None else {}
+    candidates = sorted(set(int(d) for d in degrees))
+    if not candidates:
+        raise ValueError("No candidate quadrature degrees given.")
+
+    key = None
+    cache: dict[str, int] = {}
+    if cache_file is not None:
+        key = compute_signature([form], f"quadrature_tuning;{tolerance};{candidates}")
+        cache = _load_cache(cache_file)
+        if key in cache:
+            logger.info(f"Reusing tuned quadrature degree {cache[key]} from {cache_file}")
+            return cache[key]
+
+    reference_degree = candidates[-1] + 2
+    reference = _evaluate_cell_tensor(
+        set_quadrature_degree(form, reference_degree), options, cffi_extra_compile_args
+    )
+    scale = max(np.linalg.norm(reference), 1.0)
+
+    chosen = candidates[-1]
+    for degree in candidates:
+        A = _evaluate_cell_tensor(
+            set_quadrature_degree(form, degree), options, cffi_extra_compile_args
+        )
+        error = np.linalg.norm(A - reference) / scale
+        logger.info(f"Quadrature degree {degree}: relative error {error:.3e}")
+        if error <= tolerance:
+            chosen = degree
+            break
+
+    if key is not None:
+        cache[key] = chosen
+        _store_cache(cache_file, cache)
+
+    return chosen
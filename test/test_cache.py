@@ -39,3 +39,80 @@ def test_cache_modes(compile_args):
 
     assert newname == tmpname
     assert newfile != tmpfile
+
+
+def test_ir_cache_roundtrip(tmp_path):
+    """Stages 1-2 must pickle, reload and generate identical code."""
+    element = basix.ufl.element("Lagrange", "triangle", 2, shape=(2,))
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "triangle", 1, shape=(2,)))
+    space = ufl.FunctionSpace(domain, element)
+    f = ufl.Coefficient(space)
+    u, v = ufl.TrialFunction(space), ufl.TestFunction(space)
+    a = ufl.inner(f, f) * ufl.inner(ufl.grad(u), ufl.grad(v)) * ufl.dx
+
+    import ffcx.compiler
+    import ffcx.options
+
+    options = ffcx.options.get_options()
+    code_first = ffcx.compiler.compile_ufl_objects(
+        [a], options=options, prefix="cached", ir_cache_dir=tmp_path
+    )
+
+    # Both stage caches must have been populated
+    assert list(tmp_path.glob("ffcx_analysis_*.pickle"))
+    assert list(tmp_path.glob("ffcx_ir_*.pickle"))
+
+    # The second run loads analysis and IR from disk; the code it
+    # generates from the unpickled objects must be identical
+    code_cached = ffcx.compiler.compile_ufl_objects(
+        [a], options=options, prefix="cached", ir_cache_dir=tmp_path
+    )
+    assert code_cached == code_first
+
+
+def test_ir_cache_corrupt_entry(tmp_path, caplog):
+    """A corrupt cache entry is recomputed and reported, not fatal."""
+    import logging
+
+    import ffcx.compiler
+    import ffcx.options
+
+    element = basix.ufl.element("Lagrange", "triangle", 1)
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "triangle", 1, shape=(2,)))
+    space = ufl.FunctionSpace(domain, element)
+    u, v = ufl.TrialFunction(space), ufl.TestFunction(space)
+    a = ufl.inner(u, v) * ufl.dx
+
+    options = ffcx.options.get_options()
+    code_first = ffcx.compiler.compile_ufl_objects(
+        [a], options=options, prefix="corrupt", ir_cache_dir=tmp_path
+    )
+    for entry in tmp_path.glob("ffcx_*.pickle"):
+        entry.write_bytes(b"not a pickle")
+
+    with caplog.at_level(logging.WARNING, logger="ffcx"):
+        code_second = ffcx.compiler.compile_ufl_objects(
+            [a], options=options, prefix="corrupt", ir_cache_dir=tmp_path
+        )
+    assert code_second == code_first
+    assert any("Failed to load cached compiler stage" in r.message for r in caplog.records)
+
+
+@pytest.mark.skipif(sys.platform.startswith("win32"), reason="advisory locks are POSIX only")
+def test_cache_lock_timeout(tmp_path):
+    """A reader waiting on a wedged writer must time out, not hang."""
+    import fcntl
+
+    from ffcx.codegeneration.jit import get_cached_module
+
+    module_name = "libffcx_forms_timeout_test"
+    # Pose as a writer that never finishes: flock locks held on a
+    # separate file descriptor conflict even within one process
+    writer = open(tmp_path / (module_name + ".lock"), "a")
+    fcntl.flock(writer, fcntl.LOCK_EX)
+    try:
+        with pytest.raises(TimeoutError):
+            get_cached_module(module_name, [], tmp_path, timeout=1)
+    finally:
+        fcntl.flock(writer, fcntl.LOCK_UN)
+        writer.close()
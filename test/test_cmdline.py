@@ -26,3 +26,9 @@ def test_visualise():
     subprocess.run(["ffcx", "--visualise", "Poisson.py"])
     assert os.path.isfile("S.pdf")
     assert os.path.isfile("F.pdf")
+
+
+def test_codegen_workers():
+    os.chdir(os.path.dirname(__file__))
+    subprocess.run(["ffcx", "--codegen-workers", "2", "Poisson.py"], check=True)
+    assert os.path.isfile("Poisson.c")
@@ -482,3 +482,59 @@ def test_coordinate_free_expression(compile_args):
     # Check that the expression evaluates to [1, 0] at all points
     expected = np.array([[1.0, 0.0], [1.0, 0.0], [1.0, 0.0]])
     assert np.allclose(A, expected)
+
+
+def test_batch_facet_expression(compile_args):
+    """Batched facet expressions must advance the entity index per cell."""
+    c_el = basix.ufl.element("Lagrange", "triangle", 1, shape=(3,))
+    mesh = ufl.Mesh(c_el)
+    expr = ufl.FacetNormal(mesh)
+
+    dtype = np.float64
+    points = np.array([[0.5]], dtype=dtype)
+
+    obj, _, _ = ffcx.codegeneration.jit.compile_expressions(
+        [(expr, points)], cffi_extra_compile_args=compile_args
+    )
+
+    ffi = cffi.FFI()
+    expression = obj[0]
+    c_type = "double"
+
+    coords = np.array([[0.3, 0.6, 0.1], [1.2, 0.4, 0.2], [1.3, 1.4, 0.3]], dtype=dtype)
+    w = np.array([], dtype=dtype)
+    c = np.array([], dtype=dtype)
+
+    # One batch entry per facet of the same cell, so each entry must see
+    # its own entity index
+    entity_index = np.array([0, 1, 2], dtype=np.intc)
+    quad_perm = np.array([0, 0, 0], dtype=np.dtype("uint8"))
+    A_batch = np.zeros((3, 3), dtype=dtype)
+    expression.tabulate_tensor_batch_float64(
+        3,
+        ffi.cast(f"{c_type} *", A_batch.ctypes.data),
+        ffi.cast(f"{c_type} *", w.ctypes.data),
+        ffi.cast(f"{c_type} *", c.ctypes.data),
+        ffi.cast(f"{c_type} *", coords.ctypes.data),
+        ffi.cast("int *", entity_index.ctypes.data),
+        ffi.cast("uint8_t *", quad_perm.ctypes.data),
+        ffi.NULL,
+        3,
+        0,
+        0,
+    )
+
+    for facet in range(3):
+        A_ref = np.zeros(3, dtype=dtype)
+        e = np.array([facet], dtype=np.intc)
+        qp = np.array([0], dtype=np.dtype("uint8"))
+        expression.tabulate_tensor_float64(
+            ffi.cast(f"{c_type} *", A_ref.ctypes.data),
+            ffi.cast(f"{c_type} *", w.ctypes.data),
+            ffi.cast(f"{c_type} *", c.ctypes.data),
+            ffi.cast(f"{c_type} *", coords.ctypes.data),
+            ffi.cast("int *", e.ctypes.data),
+            ffi.cast("uint8_t *", qp.ctypes.data),
+            ffi.NULL,
+        )
+        assert np.allclose(A_batch[facet], A_ref)
@@ -2082,6 +2082,78 @@ def test_diagonal_mixed_block(dtype, compile_args, shape):
     np.testing.assert_allclose(A_diag, np.diag(A))
 
 
+@pytest.mark.parametrize(
+    "dtype",
+    [
+        "float64",
+        pytest.param(
+            "complex128",
+            marks=pytest.mark.xfail(
+                sys.platform.startswith("win32"),
+                raises=NotImplementedError,
+                reason="missing _Complex",
+            ),
+        ),
+    ],
+)
+def test_symmetric_form(dtype, compile_args):
+    element = basix.ufl.element("Lagrange", "tetrahedron", 2, shape=(3,))
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "tetrahedron", 1, shape=(3,)))
+    space = ufl.FunctionSpace(domain, element)
+    u, v = ufl.TrialFunction(space), ufl.TestFunction(space)
+    a = (ufl.inner(ufl.grad(u), ufl.grad(v)) + ufl.inner(u, v)) * ufl.dx
+    forms = [a]
+    compiled_sym_forms, sym_module, _ = ffcx.codegeneration.jit.compile_forms(
+        forms,
+        options={"scalar_type": dtype, "part": "symmetric"},
+        cffi_extra_compile_args=compile_args,
+    )
+
+    sym_form0 = compiled_sym_forms[0].form_integrals[0]
+    assert sym_form0.symmetric
+
+    A_sym = np.zeros((element.dim, element.dim), dtype=dtype)
+    A = np.zeros((element.dim, element.dim), dtype=dtype)
+    w = np.array([], dtype=dtype)
+    c = np.array([], dtype=dtype)
+
+    ffi = sym_module.ffi
+    xdtype = dtype_to_scalar_dtype(dtype)
+    coords = np.array([0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0], dtype=xdtype)
+
+    c_type, c_xtype = dtype_to_c_type(dtype), dtype_to_c_type(xdtype)
+    sym_kernel = getattr(sym_form0, f"tabulate_tensor_{dtype}")
+    sym_kernel(
+        ffi.cast(f"{c_type} *", A_sym.ctypes.data),
+        ffi.cast(f"{c_type} *", w.ctypes.data),
+        ffi.cast(f"{c_type} *", c.ctypes.data),
+        ffi.cast(f"{c_xtype} *", coords.ctypes.data),
+        ffi.NULL,
+        ffi.NULL,
+        ffi.NULL,
+    )
+
+    compiled_forms, module, _code = ffcx.codegeneration.jit.compile_forms(
+        forms, options={"scalar_type": dtype}, cffi_extra_compile_args=compile_args
+    )
+    ffi = module.ffi
+
+    form0 = compiled_forms[0].form_integrals[0]
+    assert not form0.symmetric
+    kernel = getattr(form0, f"tabulate_tensor_{dtype}")
+    kernel(
+        ffi.cast(f"{c_type} *", A.ctypes.data),
+        ffi.cast(f"{c_type} *", w.ctypes.data),
+        ffi.cast(f"{c_type} *", c.ctypes.data),
+        ffi.cast(f"{c_xtype} *", coords.ctypes.data),
+        ffi.NULL,
+        ffi.NULL,
+        ffi.NULL,
+    )
+    np.testing.assert_allclose(A_sym, A_sym.T)
+    np.testing.assert_allclose(A_sym, A, atol=1e-12)
+
+
 @pytest.mark.parametrize(
     "dtype",
     [
@@ -2163,3 +2235,395 @@ def test_multiple_integrands_same_quadrature(compile_args, dtype):
         ffi.NULL,
     )
     np.testing.assert_allclose(A_mixed, A_ref)
+
+
+def _tabulate_cell_tensor(form, dtype, options, compile_args, coords, w=None, c=None, **jit_kwargs):
+    """Compile a form and tabulate its default cell integral on one cell."""
+    compiled_forms, module, _code = ffcx.codegeneration.jit.compile_forms(
+        [form],
+        options=dict(options, scalar_type=dtype),
+        cffi_extra_compile_args=compile_args,
+        **jit_kwargs,
+    )
+    ffi = module.ffi
+    integral = compiled_forms[0].form_integrals[0]
+
+    shape = tuple(arg.ufl_function_space().ufl_element().dim for arg in form.arguments()) or (1,)
+    A = np.zeros(shape, dtype=dtype)
+    w = np.array([] if w is None else w, dtype=dtype)
+    c = np.array([] if c is None else c, dtype=dtype)
+    xdtype = dtype_to_scalar_dtype(dtype)
+    coords = np.array(coords, dtype=xdtype)
+
+    c_type, c_xtype = dtype_to_c_type(dtype), dtype_to_c_type(xdtype)
+    kernel = getattr(integral, f"tabulate_tensor_{np.dtype(dtype).name}")
+    kernel(
+        ffi.cast(f"{c_type} *", A.ctypes.data),
+        ffi.cast(f"{c_type} *", w.ctypes.data),
+        ffi.cast(f"{c_type} *", c.ctypes.data),
+        ffi.cast(f"{c_xtype} *", coords.ctypes.data),
+        ffi.NULL,
+        ffi.NULL,
+        ffi.NULL,
+    )
+    return A
+
+
+_unit_tet_coords = [
+    [0.0, 0.0, 0.0],
+    [1.0, 0.0, 0.0],
+    [0.0, 1.0, 0.0],
+    [0.0, 0.0, 1.0],
+]
+
+
+def _elasticity_form():
+    """A vector-valued bilinear form whose kernels have dof-blocked loops."""
+    element = basix.ufl.element("Lagrange", "tetrahedron", 2, shape=(3,))
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "tetrahedron", 1, shape=(3,)))
+    space = ufl.FunctionSpace(domain, element)
+    u, v = ufl.TrialFunction(space), ufl.TestFunction(space)
+    eps = lambda w: ufl.sym(ufl.grad(w))  # noqa: E731
+    return (ufl.inner(eps(u), eps(v)) + ufl.inner(u, v)) * ufl.dx
+
+
+@pytest.mark.parametrize("dtype", ["float32", "float64"])
+def test_vector_width(dtype, compile_args):
+    """SIMD-annotated kernels must match the scalar ones."""
+    a = _elasticity_form()
+    A_ref = _tabulate_cell_tensor(a, dtype, {}, compile_args, _unit_tet_coords)
+    A_simd = _tabulate_cell_tensor(
+        a, dtype, {"vector_width": 4}, compile_args, _unit_tet_coords
+    )
+    np.testing.assert_allclose(A_simd, A_ref, rtol=1e-6)
+
+
+def test_parallel_translation_units(compile_args):
+    """Per-integral translation units must link into an equivalent module."""
+    dtype = "float64"
+    element = basix.ufl.element("Lagrange", "tetrahedron", 2)
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "tetrahedron", 1, shape=(3,)))
+    space = ufl.FunctionSpace(domain, element)
+    u, v = ufl.TrialFunction(space), ufl.TestFunction(space)
+    # Two integrals, so the split build produces several translation units
+    a = ufl.inner(ufl.grad(u), ufl.grad(v)) * ufl.dx + ufl.inner(u, v) * ufl.ds
+
+    A_ref = _tabulate_cell_tensor(a, dtype, {}, compile_args, _unit_tet_coords)
+    A_par = _tabulate_cell_tensor(a, dtype, {}, compile_args, _unit_tet_coords, parallel=2)
+    np.testing.assert_array_equal(A_par, A_ref)
+
+
+def test_table_pool(compile_args):
+    """Pooled file-scope tables must not change the tabulated values."""
+    dtype = "float64"
+    element = basix.ufl.element("Lagrange", "tetrahedron", 2)
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "tetrahedron", 1, shape=(3,)))
+    space = ufl.FunctionSpace(domain, element)
+    u, v = ufl.TrialFunction(space), ufl.TestFunction(space)
+    # Two forms over the same space, so their kernels share tables
+    a = ufl.inner(ufl.grad(u), ufl.grad(v)) * ufl.dx
+    m = ufl.inner(u, v) * ufl.dx
+
+    compiled_forms, module, code = ffcx.codegeneration.jit.compile_forms(
+        [a, m], options={"scalar_type": dtype}, cffi_extra_compile_args=compile_args
+    )
+    assert "FE_pool" in code[1]
+
+    ffi = module.ffi
+    coords = np.array(_unit_tet_coords, dtype=dtype)
+    dim = element.dim
+    for form, compiled_form in zip([a, m], compiled_forms):
+        A = np.zeros((dim, dim), dtype=dtype)
+        w = np.array([], dtype=dtype)
+        c = np.array([], dtype=dtype)
+        kernel = getattr(compiled_form.form_integrals[0], f"tabulate_tensor_{dtype}")
+        kernel(
+            ffi.cast("double *", A.ctypes.data),
+            ffi.cast("double *", w.ctypes.data),
+            ffi.cast("double *", c.ctypes.data),
+            ffi.cast("double *", coords.ctypes.data),
+            ffi.NULL,
+            ffi.NULL,
+            ffi.NULL,
+        )
+        # The same form compiled on its own carries private table copies
+        A_ref = _tabulate_cell_tensor(form, dtype, {}, compile_args, _unit_tet_coords)
+        np.testing.assert_array_equal(A, A_ref)
+
+
+def test_rank1_action(compile_args):
+    """Fused rank-1 accumulation must match the matrix-vector product."""
+    dtype = "float64"
+    element = basix.ufl.element("Lagrange", "tetrahedron", 2, shape=(3,))
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "tetrahedron", 1, shape=(3,)))
+    space = ufl.FunctionSpace(domain, element)
+    u, v = ufl.TrialFunction(space), ufl.TestFunction(space)
+    f = ufl.Coefficient(space)
+    # Vector-valued form, so several blocks accumulate into the output
+    a = (ufl.inner(ufl.grad(u), ufl.grad(v)) + ufl.inner(u, v)) * ufl.dx
+    L = ufl.action(a, f)
+
+    rng = np.random.default_rng(7)
+    w = rng.random(element.dim)
+    A = _tabulate_cell_tensor(a, dtype, {}, compile_args, _unit_tet_coords)
+    b = _tabulate_cell_tensor(L, dtype, {}, compile_args, _unit_tet_coords, w=w)
+    np.testing.assert_allclose(b, A @ w, rtol=1e-12)
+
+
+def test_specialize_facet_permutations(compile_args):
+    """Specialized permutation kernels must match the generic kernel."""
+    dtype = "float64"
+    element = basix.ufl.element("Lagrange", "triangle", 2)
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "triangle", 1, shape=(2,)))
+    space = ufl.FunctionSpace(domain, element)
+    u, v = ufl.TrialFunction(space), ufl.TestFunction(space)
+    a = ufl.inner(ufl.jump(ufl.grad(u)), ufl.jump(ufl.grad(v))) * ufl.dS
+
+    compiled_forms, module, _code = ffcx.codegeneration.jit.compile_forms(
+        [a],
+        options={"scalar_type": dtype, "specialize_facet_permutations": True},
+        cffi_extra_compile_args=compile_args,
+    )
+    ffi = module.ffi
+    integral = compiled_forms[0].form_integrals[0]
+    num_perms = integral.num_facet_permutations
+    assert num_perms == 2
+    assert integral.tabulate_tensor_permuted != ffi.NULL
+
+    dim = 2 * element.dim
+    w = np.array([], dtype=dtype)
+    c = np.array([], dtype=dtype)
+    facets = np.array([0, 2], dtype=np.intc)
+    coords = np.array(
+        [
+            [0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0],
+            [1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0],
+        ],
+        dtype=dtype,
+    )
+
+    kernel_type = (
+        "void(*)(double *, const double *, const double *, const double *, "
+        "const int *, const uint8_t *, void *)"
+    )
+    generic = getattr(integral, f"tabulate_tensor_{dtype}")
+    for p0 in range(num_perms):
+        for p1 in range(num_perms):
+            perms = np.array([p0, p1], dtype=np.uint8)
+            A_ref = np.zeros((dim, dim), dtype=dtype)
+            generic(
+                ffi.cast("double *", A_ref.ctypes.data),
+                ffi.cast("double *", w.ctypes.data),
+                ffi.cast("double *", c.ctypes.data),
+                ffi.cast("double *", coords.ctypes.data),
+                ffi.cast("int *", facets.ctypes.data),
+                ffi.cast("uint8_t *", perms.ctypes.data),
+                ffi.NULL,
+            )
+            # The specialized variant must ignore the permutation argument
+            specialized = ffi.cast(
+                kernel_type, integral.tabulate_tensor_permuted[p0 * num_perms + p1]
+            )
+            A = np.zeros((dim, dim), dtype=dtype)
+            specialized(
+                ffi.cast("double *", A.ctypes.data),
+                ffi.cast("double *", w.ctypes.data),
+                ffi.cast("double *", c.ctypes.data),
+                ffi.cast("double *", coords.ctypes.data),
+                ffi.cast("int *", facets.ctypes.data),
+                ffi.NULL,
+                ffi.NULL,
+            )
+            np.testing.assert_array_equal(A, A_ref)
+
+
+def test_packed_coefficients(compile_args):
+    """Packed coefficient scratch arrays must not change the values."""
+    dtype = "float64"
+    element = basix.ufl.element("Lagrange", "tetrahedron", 2, shape=(3,))
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "tetrahedron", 1, shape=(3,)))
+    space = ufl.FunctionSpace(domain, element)
+    v = ufl.TestFunction(space)
+    # A blocked coefficient, so its dof access in w is strided
+    f = ufl.Coefficient(space)
+    L = (ufl.inner(f, v) + ufl.inner(ufl.grad(f), ufl.grad(v))) * ufl.dx
+
+    rng = np.random.default_rng(23)
+    w = rng.random(element.dim)
+    b_ref = _tabulate_cell_tensor(L, dtype, {}, compile_args, _unit_tet_coords, w=w)
+    b_packed = _tabulate_cell_tensor(
+        L, dtype, {"packed_coefficients": True}, compile_args, _unit_tet_coords, w=w
+    )
+    np.testing.assert_allclose(b_packed, b_ref, rtol=1e-12)
+
+
+def test_unroll_threshold(compile_args):
+    """Unrolled-and-jammed quadrature loops must match the rolled ones."""
+    dtype = "float64"
+    a = _elasticity_form()
+    A_ref = _tabulate_cell_tensor(a, dtype, {}, compile_args, _unit_tet_coords)
+    A_unrolled = _tabulate_cell_tensor(
+        a, dtype, {"unroll_threshold": 32}, compile_args, _unit_tet_coords
+    )
+    np.testing.assert_allclose(A_unrolled, A_ref, rtol=1e-12)
+
+
+@pytest.mark.skipif(sys.platform.startswith("win32"), reason="table sidecar uses POSIX mmap")
+def test_table_sidecar(tmp_path, compile_args):
+    """Tables mapped from a binary sidecar must match in-source tables."""
+    dtype = "float64"
+    a = _elasticity_form()
+    # Characters that must survive embedding the path in the generated C
+    sidecar_dir = tmp_path / 'odd 100% "dir\\'
+    sidecar_dir.mkdir()
+    sidecar = sidecar_dir / "tables.bin"
+
+    A_ref = _tabulate_cell_tensor(a, dtype, {}, compile_args, _unit_tet_coords)
+    A_sidecar = _tabulate_cell_tensor(
+        a, dtype, {"table_sidecar": str(sidecar)}, compile_args, _unit_tet_coords
+    )
+    assert sidecar.exists()
+    np.testing.assert_array_equal(A_sidecar, A_ref)
+
+
+def test_codegen_workers(compile_args):
+    """Parallel code generation must tabulate the same values."""
+    dtype = "float64"
+    a = _elasticity_form()
+    A_ref = _tabulate_cell_tensor(a, dtype, {}, compile_args, _unit_tet_coords)
+    # The parallel path skips file-scope table pooling, so compare the
+    # kernel output rather than the generated source
+    A_par = _tabulate_cell_tensor(
+        a, dtype, {}, compile_args, _unit_tet_coords, codegen_workers=2
+    )
+    np.testing.assert_array_equal(A_par, A_ref)
+
+
+def test_point_loop_collapse(compile_args):
+    """Vertex and ridge integrals must compile without a quadrature loop.
+
+    Correctness of the collapsed kernels is covered by
+    test_vertex_integral and test_ridge_integral; this only checks that
+    the point loops are actually gone from the generated code.
+    """
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "tetrahedron", 1, shape=(3,)))
+    element = basix.ufl.element("Lagrange", "tetrahedron", 1)
+    space = ufl.FunctionSpace(domain, element)
+    x = ufl.SpatialCoordinate(domain)
+    v = ufl.TestFunction(space)
+    vertex_form = x[0] * ufl.conj(v) * ufl.Measure("dP")
+    ridge_form = x[2] * ufl.conj(v) * ufl.Measure("dr", domain=domain)
+
+    for form in (vertex_form, ridge_form):
+        _compiled, _module, code = ffcx.codegeneration.jit.compile_forms(
+            [form], options={"scalar_type": "float64"}, cffi_extra_compile_args=compile_args
+        )
+        assert "for (int iq" not in code[1]
+
+
+def test_table_alignment(compile_args):
+    """Padded, aligned element tables must not change the values."""
+    dtype = "float64"
+    a = _elasticity_form()
+    A_ref = _tabulate_cell_tensor(a, dtype, {}, compile_args, _unit_tet_coords)
+    A_aligned = _tabulate_cell_tensor(
+        a, dtype, {"table_alignment": 64}, compile_args, _unit_tet_coords
+    )
+    np.testing.assert_array_equal(A_aligned, A_ref)
+
+
+def test_baked_constants(compile_args):
+    """Constants folded into the kernel must match runtime constants."""
+    dtype = "float64"
+    element = basix.ufl.element("Lagrange", "tetrahedron", 1)
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "tetrahedron", 1, shape=(3,)))
+    space = ufl.FunctionSpace(domain, element)
+    u, v = ufl.TrialFunction(space), ufl.TestFunction(space)
+    kappa = ufl.Constant(domain)
+    a = kappa * ufl.inner(ufl.grad(u), ufl.grad(v)) * ufl.dx
+
+    A_ref = _tabulate_cell_tensor(a, dtype, {}, compile_args, _unit_tet_coords, c=[2.5])
+    # The baked kernel no longer reads the runtime constants array
+    A_baked = _tabulate_cell_tensor(
+        a, dtype, {}, compile_args, _unit_tet_coords, baked_constants={kappa: 2.5}
+    )
+    np.testing.assert_allclose(A_baked, A_ref, rtol=1e-12)
+
+
+def test_profile_file(tmp_path, compile_args):
+    """Compiling with profile_file must write a per-stage JSON profile."""
+    import json
+
+    element = basix.ufl.element("Lagrange", "triangle", 1)
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "triangle", 1, shape=(2,)))
+    space = ufl.FunctionSpace(domain, element)
+    u, v = ufl.TrialFunction(space), ufl.TestFunction(space)
+    a = ufl.inner(u, v) * ufl.dx
+
+    profile_file = tmp_path / "profile.json"
+    ffcx.codegeneration.jit.compile_forms(
+        [a],
+        options={"scalar_type": "float64", "profile_file": str(profile_file)},
+        cffi_extra_compile_args=compile_args,
+    )
+    with open(profile_file) as f:
+        profile = json.load(f)
+    for stage in ("analysis", "compute_ir", "generate_code", "format_code", "c_compiler"):
+        assert stage in profile["stages"]
+    assert profile["integrals"]
+
+
+def test_coefficient_variants(compile_args):
+    """Stripped-coefficient variants must match the full kernel on zero data."""
+    from ffcx.specialization import compile_coefficient_variants
+
+    dtype = "float64"
+    element = basix.ufl.element("Lagrange", "tetrahedron", 1)
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "tetrahedron", 1, shape=(3,)))
+    space = ufl.FunctionSpace(domain, element)
+    u, v = ufl.TrialFunction(space), ufl.TestFunction(space)
+    f, g = ufl.Coefficient(space), ufl.Coefficient(space)
+    a = (f * ufl.inner(ufl.grad(u), ufl.grad(v)) + g * ufl.inner(u, v)) * ufl.dx
+
+    variants, module, _code = compile_coefficient_variants(
+        a, [[], [g]], options={"scalar_type": dtype}, cffi_extra_compile_args=compile_args
+    )
+    full, stripped = variants
+
+    # The stripped variant drops g and keeps f at its original position
+    assert full.num_coefficients == 2
+    assert stripped.num_coefficients == 1
+    assert stripped.original_coefficient_positions[0] == 0
+
+    ffi = module.ffi
+    dim = element.dim
+    coords = np.array(_unit_tet_coords, dtype=dtype)
+    rng = np.random.default_rng(22)
+    f_dofs = rng.random(dim)
+    c = np.array([], dtype=dtype)
+
+    def tabulate(form, w):
+        A = np.zeros((dim, dim), dtype=dtype)
+        w = np.asarray(w, dtype=dtype)
+        kernel = getattr(form.form_integrals[0], f"tabulate_tensor_{dtype}")
+        kernel(
+            ffi.cast("double *", A.ctypes.data),
+            ffi.cast("double *", w.ctypes.data),
+            ffi.cast("double *", c.ctypes.data),
+            ffi.cast("double *", coords.ctypes.data),
+            ffi.NULL,
+            ffi.NULL,
+            ffi.NULL,
+        )
+        return A
+
+    A_full = tabulate(full, np.concatenate([f_dofs, np.zeros(dim)]))
+    A_stripped = tabulate(stripped, f_dofs)
+    np.testing.assert_allclose(A_stripped, A_full, rtol=1e-12)
+
+    # Stripping every coefficient zeroes the whole form, which cannot
+    # be compiled
+    with pytest.raises(RuntimeError):
+        compile_coefficient_variants(
+            a, [[f, g]], options={"scalar_type": dtype}, cffi_extra_compile_args=compile_args
+        )
@@ -0,0 +1,166 @@
+# Copyright (C) 2026 The FEniCS Project
+#
+# This file is part of FFCx. (https://www.fenicsproject.org)
+#
+# SPDX-License-Identifier:    LGPL-3.0-or-later
+"""Correctness tests for the LNodes optimizer passes.
+
+Each test builds a small piece of LNodes code, runs one optimizer pass
+on a deep copy, compiles both versions to C with CFFI and checks that
+they compute the same numbers.
+"""
+
+import copy
+import importlib
+
+import numpy as np
+from cffi import FFI
+
+from ffcx.codegeneration import lnodes as L
+from ffcx.codegeneration.C.c_implementation import CFormatter
+from ffcx.codegeneration.optimizer import cse, reuse_arrays, unroll_loops
+
+
+def compile_code(module_name, decl, code):
+    """Compile a list of LNodes into a C function and return (function, ffi)."""
+    Q = CFormatter(dtype="float64")
+    c_code = decl + "{\n" + Q.c_format(L.StatementList(code)) + "\n}\n"
+
+    ffibuilder = FFI()
+    ffibuilder.cdef(decl + ";")
+    ffibuilder.set_source(module_name, c_code)
+    ffibuilder.compile(verbose=True)
+    module = importlib.import_module(module_name)
+    return module.lib.run, module.ffi
+
+
+def test_cse():
+    # Repeated products and sums across the assignments of an
+    # "Intermediates" section must collapse onto cse temporaries without
+    # changing the computed values
+    x = L.Symbol("x", dtype=L.DataType.SCALAR)
+    y = L.Symbol("y", dtype=L.DataType.SCALAR)
+    t = L.Symbol("t", dtype=L.DataType.SCALAR)
+
+    def make_section():
+        statements = [
+            L.Assign(t[0], x * y + x),
+            L.Assign(t[1], x * y + y),
+            L.Assign(t[2], (x + y) * (x + y)),
+        ]
+        return L.Section("Intermediates", statements, [], [x, y], [t])
+
+    section = make_section()
+    optimized = cse(copy.deepcopy(section))
+
+    # x*y (across statements) and x+y (within one statement) repeat
+    temps = [d.symbol.name for d in optimized.declarations]
+    assert sum(name.startswith("cse_") for name in temps) == 2
+
+    decl = "void run(double *t, double x, double y)"
+    run_ref, ffi_ref = compile_code("_cse_ref", decl, [section])
+    run_opt, ffi_opt = compile_code("_cse_opt", decl, [optimized])
+
+    rng = np.random.default_rng(13)
+    x_val, y_val = rng.random(2)
+    t_ref = np.zeros(3, dtype=np.float64)
+    t_opt = np.zeros(3, dtype=np.float64)
+    run_ref(ffi_ref.cast("double *", t_ref.ctypes.data), x_val, y_val)
+    run_opt(ffi_opt.cast("double *", t_opt.ctypes.data), x_val, y_val)
+    assert np.allclose(t_opt, t_ref)
+
+
+def test_reuse_arrays():
+    # Temporary arrays from different sections have disjoint lifetimes
+    # and must fold onto one arena without changing the computed values
+    x = L.Symbol("x", dtype=L.DataType.SCALAR)
+    t = L.Symbol("t", dtype=L.DataType.SCALAR)
+    i = L.Symbol("i", dtype=L.DataType.INT)
+
+    def make_code():
+        sections = []
+        for s, size in enumerate((4, 8)):
+            temp = L.Symbol("temp_0", dtype=L.DataType.SCALAR)
+            statements = [
+                L.ArrayDecl(temp, size, [0]),
+                L.ForRange(i, 0, size, [L.Assign(temp[i], x[i] * x[i])]),
+                L.ForRange(i, 0, size, [L.AssignAdd(t[s], temp[i])]),
+            ]
+            sections.append(L.Section(f"Section {s}", statements, [], [x], [t]))
+        return sections
+
+    reference = make_code()
+    optimized = reuse_arrays(make_code())
+
+    # One arena slot, sized for the larger of the two arrays
+    arena = [s for s in optimized if isinstance(s, L.ArrayDecl)]
+    assert len(arena) == 1
+    assert arena[0].symbol.name == "temp_arena_0"
+    assert arena[0].sizes == (8,)
+
+    decl = "void run(double *t, double *x)"
+    run_ref, ffi_ref = compile_code("_reuse_ref", decl, reference)
+    run_opt, ffi_opt = compile_code("_reuse_opt", decl, optimized)
+
+    rng = np.random.default_rng(17)
+    x_val = rng.random(8)
+    t_ref = np.zeros(2, dtype=np.float64)
+    t_opt = np.zeros(2, dtype=np.float64)
+    run_ref(
+        ffi_ref.cast("double *", t_ref.ctypes.data), ffi_ref.cast("double *", x_val.ctypes.data)
+    )
+    run_opt(
+        ffi_opt.cast("double *", t_opt.ctypes.data), ffi_opt.cast("double *", x_val.ctypes.data)
+    )
+    assert np.allclose(t_opt, t_ref)
+
+
+def test_unroll_loops():
+    # Unroll-and-jam of a short quadrature loop must leave one fused
+    # argument-dof sweep and unchanged values
+    w = L.Symbol("w", dtype=L.DataType.SCALAR)
+    t = L.Symbol("t", dtype=L.DataType.SCALAR)
+    iq = L.Symbol("iq", dtype=L.DataType.INT)
+    i = L.Symbol("i", dtype=L.DataType.INT)
+
+    def make_code():
+        tv = L.Symbol("tv", dtype=L.DataType.SCALAR)
+        intermediates = L.Section(
+            "Intermediates", [], [L.VariableDecl(tv, w[iq] * w[iq])], [w], []
+        )
+        store = L.Section(
+            "Tensor Computation",
+            [L.ForRange(i, 0, 4, [L.AssignAdd(t[i], tv * w[iq])])],
+            [],
+            [w],
+            [t],
+        )
+        return [L.ForRange(iq, 0, 3, [intermediates, store])]
+
+    reference = make_code()
+    optimized = unroll_loops(make_code(), threshold=3)
+
+    # The quadrature loop is gone and the store sections are jammed
+    # onto a single dof loop
+    assert not any(isinstance(s, L.ForRange) for s in optimized)
+    stores = [
+        s for s in optimized if isinstance(s, L.Section) and s.name == "Tensor Computation"
+    ]
+    assert len(stores) == 1
+    assert sum(isinstance(s, L.ForRange) for s in stores[0].statements) == 1
+
+    decl = "void run(double *t, double *w)"
+    run_ref, ffi_ref = compile_code("_unroll_ref", decl, reference)
+    run_opt, ffi_opt = compile_code("_unroll_opt", decl, optimized)
+
+    rng = np.random.default_rng(24)
+    w_val = rng.random(3)
+    t_ref = np.zeros(4, dtype=np.float64)
+    t_opt = np.zeros(4, dtype=np.float64)
+    run_ref(
+        ffi_ref.cast("double *", t_ref.ctypes.data), ffi_ref.cast("double *", w_val.ctypes.data)
+    )
+    run_opt(
+        ffi_opt.cast("double *", t_opt.ctypes.data), ffi_opt.cast("double *", w_val.ctypes.data)
+    )
+    assert np.allclose(t_opt, t_ref)
@@ -0,0 +1,92 @@
+# Copyright (C) 2026 The FEniCS Project
+#
+# This file is part of FFCx. (https://www.fenicsproject.org)
+#
+# SPDX-License-Identifier:    LGPL-3.0-or-later
+"""Tests for the streaming code emission path."""
+
+import importlib
+import re
+import sys
+
+import basix.ufl
+import numpy as np
+import ufl
+from cffi import FFI
+
+import ffcx.codegeneration
+from ffcx import compiler
+from ffcx.options import get_options
+
+
+def _compile_kernel(module_name, code_c, kernel_name, output_dir):
+    """Compile a generated C file with CFFI and return (lib, ffi)."""
+    output_dir.mkdir(exist_ok=True)
+    ffibuilder = FFI()
+    ffibuilder.cdef(
+        f"void {kernel_name}(double* A, const double* w, const double* c,"
+        " const double* coordinate_dofs, const int* entity_local_index,"
+        " const uint8_t* quadrature_permutation, void* custom_data);"
+    )
+    ffibuilder.set_source(
+        module_name, code_c, include_dirs=[ffcx.codegeneration.get_include_path()]
+    )
+    ffibuilder.compile(tmpdir=str(output_dir), verbose=True)
+    sys.path.insert(0, str(output_dir))
+    try:
+        module = importlib.import_module(module_name)
+    finally:
+        sys.path.remove(str(output_dir))
+    return module.lib, module.ffi
+
+
+def test_stream_matches_format(tmp_path):
+    """Streamed emission must match the in-memory formatting path.
+
+    The generated header must be byte-identical. The source differs by
+    design in where element tables are declared (in-kernel when
+    streaming, pooled at file scope otherwise), so the kernels are
+    compared on the element tensors they compute.
+    """
+    element = basix.ufl.element("Lagrange", "triangle", 1)
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "triangle", 1, shape=(2,)))
+    space = ufl.FunctionSpace(domain, element)
+    u = ufl.TrialFunction(space)
+    v = ufl.TestFunction(space)
+    a = (ufl.inner(ufl.grad(u), ufl.grad(v)) + ufl.inner(u, v)) * ufl.dx
+
+    options = get_options()
+    code_h, code_c = compiler.compile_ufl_objects([a], options=options, prefix="stream_demo")
+    compiler.compile_ufl_objects_to_files(
+        [a], options=options, prefix="stream_demo", output_dir=str(tmp_path)
+    )
+    streamed_h = (tmp_path / "stream_demo.h").read_text()
+    streamed_c = (tmp_path / "stream_demo.c").read_text()
+
+    # Declarations do not involve element tables
+    assert streamed_h == code_h
+
+    # Both sources must define the same kernels, in the same order
+    kernel_names = re.findall(r"void (tabulate_tensor_(?!batch_)\w+)\(", code_c)
+    assert kernel_names
+    assert kernel_names == re.findall(r"void (tabulate_tensor_(?!batch_)\w+)\(", streamed_c)
+
+    kernel_name = kernel_names[0]
+    lib_ref, ffi = _compile_kernel("stream_demo_ref", code_c, kernel_name, tmp_path / "ref")
+    lib_stream, _ = _compile_kernel("stream_demo_out", streamed_c, kernel_name, tmp_path / "out")
+
+    coords = np.array([[0.0, 0.0, 0.0], [1.0, 0.0, 0.0], [0.0, 1.0, 0.0]], dtype=np.float64)
+    A_ref = np.zeros((3, 3), dtype=np.float64)
+    A_stream = np.zeros((3, 3), dtype=np.float64)
+    for A, lib in ((A_ref, lib_ref), (A_stream, lib_stream)):
+        getattr(lib, kernel_name)(
+            ffi.cast("double *", A.ctypes.data),
+            ffi.NULL,
+            ffi.NULL,
+            ffi.cast("double *", coords.ctypes.data),
+            ffi.NULL,
+            ffi.NULL,
+            ffi.NULL,
+        )
+    assert not np.allclose(A_ref, 0.0)
+    assert np.allclose(A_stream, A_ref)
@@ -130,3 +130,130 @@ def test_bilinear_form(dtype, P, cell_type):
     )
 
     np.testing.assert_allclose(A, A1, rtol=1e-6, atol=1e-6)
+
+
+@pytest.mark.parametrize("dtype", ["float32", "float64"])
+@pytest.mark.parametrize("P", [1, 2])
+def test_vector_element(dtype, P):
+    """Sum factorization of a blocked element goes through its scalar sub-element."""
+    cell_type = basix.CellType.quadrilateral
+    element = create_tensor_product_element(
+        cell_type, P, basix.LagrangeVariant.gll_warped, shape=(2,)
+    )
+    coords_element = create_tensor_product_element(
+        cell_type, 1, basix.LagrangeVariant.gll_warped, shape=(2,)
+    )
+    mesh = ufl.Mesh(coords_element)
+    V = ufl.FunctionSpace(mesh, element)
+
+    u, v = ufl.TrialFunction(V), ufl.TestFunction(V)
+    a = ufl.inner(ufl.grad(u), ufl.grad(v)) * ufl.dx
+
+    ndofs = element.dim
+    w = np.array([], dtype=dtype)
+    c = np.array([], dtype=dtype)
+    xdtype = dtype_to_scalar_dtype(dtype)
+    coords = np.array(
+        [[0.0, 0.0, 0.0], [1.1, 0.0, 0.0], [0.0, 0.9, 0.0], [1.0, 1.0, 0.0]], dtype=xdtype
+    )
+    c_type = dtype_to_c_type(dtype)
+    c_xtype = dtype_to_c_type(xdtype)
+
+    results = []
+    for sf in (False, True):
+        A = np.zeros((ndofs, ndofs), dtype=dtype)
+        kernel, _code, module = generate_kernel(
+            [a], dtype, options={"scalar_type": dtype, "sum_factorization": sf}
+        )
+        ffi = module.ffi
+        kernel(
+            ffi.cast(f"{c_type} *", A.ctypes.data),
+            ffi.cast(f"{c_type} *", w.ctypes.data),
+            ffi.cast(f"{c_type} *", c.ctypes.data),
+            ffi.cast(f"{c_xtype} *", coords.ctypes.data),
+            ffi.NULL,
+            ffi.NULL,
+            ffi.NULL,
+        )
+        results.append(A)
+
+    np.testing.assert_allclose(results[0], results[1], rtol=1e-5, atol=1e-5)
+
+
+@pytest.mark.parametrize("dtype", ["float64"])
+@pytest.mark.parametrize("P", [1, 2])
+def test_prism(dtype, P):
+    """Prism cell integrals compile and agree with sum_factorization enabled.
+
+    Prism quadrature has triangle x interval tensor structure; elements
+    without a tensor-product factorisation fall back to unfactorized
+    tables rather than failing.
+    """
+    element = basix.ufl.element("Lagrange", "prism", P)
+    mesh = ufl.Mesh(basix.ufl.element("Lagrange", "prism", 1, shape=(3,)))
+    V = ufl.FunctionSpace(mesh, element)
+
+    u, v = ufl.TrialFunction(V), ufl.TestFunction(V)
+    a = ufl.inner(ufl.grad(u), ufl.grad(v)) * ufl.dx
+
+    ndofs = element.dim
+    w = np.array([], dtype=dtype)
+    c = np.array([], dtype=dtype)
+    xdtype = dtype_to_scalar_dtype(dtype)
+    coords = np.array(
+        [
+            [0.0, 0.0, 0.0],
+            [1.0, 0.0, 0.0],
+            [0.0, 1.0, 0.0],
+            [0.0, 0.0, 1.0],
+            [1.0, 0.0, 1.0],
+            [0.0, 1.0, 1.0],
+        ],
+        dtype=xdtype,
+    )
+    c_type = dtype_to_c_type(dtype)
+    c_xtype = dtype_to_c_type(xdtype)
+
+    results = []
+    for sf in (False, True):
+        A = np.zeros((ndofs, ndofs), dtype=dtype)
+        kernel, _code, module = generate_kernel(
+            [a], dtype, options={"scalar_type": dtype, "sum_factorization": sf}
+        )
+        ffi = module.ffi
+        kernel(
+            ffi.cast(f"{c_type} *", A.ctypes.data),
+            ffi.cast(f"{c_type} *", w.ctypes.data),
+            ffi.cast(f"{c_type} *", c.ctypes.data),
+            ffi.cast(f"{c_xtype} *", coords.ctypes.data),
+            ffi.NULL,
+            ffi.NULL,
+            ffi.NULL,
+        )
+        results.append(A)
+
+    np.testing.assert_allclose(results[0], results[1], rtol=1e-9, atol=1e-9)
+
+
+def test_facet_integral_fallback():
+    """Facet integrals compile with sum_factorization, using the fallback tables."""
+    dtype = "float64"
+    cell_type = basix.CellType.quadrilateral
+    element = create_tensor_product_element(cell_type, 2, basix.LagrangeVariant.gll_warped)
+    coords_element = create_tensor_product_element(
+        cell_type, 1, basix.LagrangeVariant.gll_warped, shape=(2,)
+    )
+    mesh = ufl.Mesh(coords_element)
+    V = ufl.FunctionSpace(mesh, element)
+
+    u, v = ufl.TrialFunction(V), ufl.TestFunction(V)
+    a = ufl.inner(u, v) * ufl.ds
+
+    compiled_forms, module, _code = ffcx.codegeneration.jit.compile_forms(
+        [a],
+        cache_dir="./ffcx-cache-facet-sf",
+        options={"scalar_type": dtype, "sum_factorization": True},
+    )
+    offsets = compiled_forms[0].form_integral_offsets
+    facet = module.lib.exterior_facet
+    assert offsets[facet + 1] - offsets[facet] == 1
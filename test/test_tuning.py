@@ -0,0 +1,48 @@
+# Copyright (C) 2026 The FEniCS Project
+#
+# This file is part of FFCx. (https://www.fenicsproject.org)
+#
+# SPDX-License-Identifier:    LGPL-3.0-or-later
+
+import basix.ufl
+import pytest
+import ufl
+
+from ffcx.tuning import tune_quadrature_degree
+
+
+@pytest.mark.parametrize("dtype", ["float32", "float64"])
+def test_tune_quadrature_degree(dtype, compile_args):
+    # Quadratic geometry, so the integrand is non-polynomial and the
+    # chosen degree actually depends on the tolerance
+    element = basix.ufl.element("Lagrange", "triangle", 2)
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "triangle", 2, shape=(2,)))
+    space = ufl.FunctionSpace(domain, element)
+    u, v = ufl.TrialFunction(space), ufl.TestFunction(space)
+    a = ufl.inner(ufl.grad(u), ufl.grad(v)) * ufl.dx
+
+    candidates = range(1, 7)
+    degree = tune_quadrature_degree(
+        a,
+        tolerance=1e-4,
+        degrees=candidates,
+        options={"scalar_type": dtype},
+        cffi_extra_compile_args=compile_args,
+    )
+    assert degree in candidates
+
+
+def test_tuning_cache(tmp_path, compile_args):
+    element = basix.ufl.element("Lagrange", "triangle", 1)
+    domain = ufl.Mesh(basix.ufl.element("Lagrange", "triangle", 1, shape=(2,)))
+    space = ufl.FunctionSpace(domain, element)
+    u, v = ufl.TrialFunction(space), ufl.TestFunction(space)
+    a = ufl.inner(u, v) * ufl.dx
+
+    cache_file = tmp_path / "tuning.json"
+    degree = tune_quadrature_degree(
+        a, cache_file=cache_file, cffi_extra_compile_args=compile_args
+    )
+    assert cache_file.exists()
+    # Second call must hit the cache and agree
+    assert tune_quadrature_degree(a, cache_file=cache_file) == degree